@@ -70,4 +70,44 @@ PyBufferProcs SbkQByteArrayBufferProc = {
 
 }
 
+#elif !defined(Py_LIMITED_API)
+
+// QByteArray buffer protocol functions
+// see: http://www.python.org/dev/peps/pep-3118/
+
+extern "C" {
+
+static int SbkQByteArray_getbufferproc(PyObject* self, Py_buffer* view, int flags)
+{
+    if (!Shiboken::Object::isValid(self))
+        return -1;
+
+    QByteArray* cppSelf = %CONVERTTOCPP[QByteArray*](self);
+    // Views are read-only unless write access is requested, which needs an unshared
+    // array, so that writing through the view does not touch other copies or raw data.
+    // The view holds its own reference to the array data, which keeps the memory alive
+    // even if the wrapped array is resized, reassigned or destroyed while the view exists.
+    // Since that reference shares the data, modifying the array through its own API
+    // detaches it from the view: writes through the view reach the array until then.
+    const bool writable = (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE;
+    char* data = writable ? cppSelf->data() : const_cast<char*>(cppSelf->constData());
+    if (PyBuffer_FillInfo(view, self, data, cppSelf->size(), writable ? 0 : 1, flags) < 0)
+        return -1;
+    view->internal = new QByteArray(*cppSelf);
+    return 0;
+}
+
+static void SbkQByteArray_releasebufferproc(PyObject*, Py_buffer* view)
+{
+    delete reinterpret_cast<QByteArray*>(view->internal);
+    view->internal = 0;
+}
+
+static PyBufferProcs SbkQByteArrayBufferProc = {
+    /*bf_getbuffer*/     &SbkQByteArray_getbufferproc,
+    /*bf_releasebuffer*/ &SbkQByteArray_releasebufferproc
+};
+
+}
+
 #endif
@@ -0,0 +1,222 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Creates a QImage on the memory of a Python buffer object. The image holds a view
+// of the buffer, which keeps the exporting object alive and its memory locked,
+// until the last QImage sharing the data is destroyed.
+// Read-only buffers are used with the const uchar* constructors, so that QImage
+// copies the data when it is modified instead of writing to them.
+
+static void SbkQImage_releaseBufferView(void* info)
+{
+    Py_buffer* view = reinterpret_cast<Py_buffer*>(info);
+    if (Py_IsInitialized()) {
+        Shiboken::GilState gil;
+        PyBuffer_Release(view);
+    }
+    delete view;
+}
+
+static bool SbkQImage_getBufferView(PyObject* pyBuffer, Py_buffer* view)
+{
+    if (PyObject_GetBuffer(pyBuffer, view, PyBUF_WRITABLE | PyBUF_ND) == 0)
+        return true;
+    PyErr_Clear();
+    if (PyObject_GetBuffer(pyBuffer, view, PyBUF_ND) == 0)
+        return true;
+#ifndef IS_PY3K
+    // Objects implementing only the old buffer protocol
+    PyErr_Clear();
+    Py_ssize_t size = 0;
+    void* data = Shiboken::Buffer::getPointer(pyBuffer, &size);
+    if (data && PyBuffer_FillInfo(view, pyBuffer, data, size, 1, PyBUF_SIMPLE) == 0)
+        return true;
+#endif
+    if (!PyErr_Occurred())
+        PyErr_SetString(PyExc_TypeError, "QImage: the image data must support the buffer protocol.");
+    return false;
+}
+
+static QImage* SbkQImage_fromBuffer(PyObject* pyBuffer, int width, int height, int bytesPerLine, QImage::Format format)
+{
+    Py_buffer* view = new Py_buffer;
+    if (!SbkQImage_getBufferView(pyBuffer, view)) {
+        delete view;
+        return 0;
+    }
+
+    QImage* image = 0;
+    if (view->readonly) {
+        const uchar* data = reinterpret_cast<const uchar*>(view->buf);
+        image = bytesPerLine < 0
+            ? new QImage(data, width, height, format, SbkQImage_releaseBufferView, view)
+            : new QImage(data, width, height, bytesPerLine, format, SbkQImage_releaseBufferView, view);
+    } else {
+        uchar* data = reinterpret_cast<uchar*>(view->buf);
+        image = bytesPerLine < 0
+            ? new QImage(data, width, height, format, SbkQImage_releaseBufferView, view)
+            : new QImage(data, width, height, bytesPerLine, format, SbkQImage_releaseBufferView, view);
+    }
+    if (image->isNull()) {
+        // QImage does not call the cleanup function when it rejects the arguments.
+        PyBuffer_Release(view);
+        delete view;
+        return image;
+    }
+    // Do not let QImage access memory beyond the end of the buffer.
+    const Py_ssize_t requiredSize = Py_ssize_t(image->bytesPerLine()) * Py_ssize_t(height);
+    if (view->len < requiredSize) {
+        const Py_ssize_t bufferSize = view->len;
+        delete image;
+        Shiboken::warning(PyExc_RuntimeWarning, 0,
+                          "QImage: the buffer of %ld bytes is too small for the image, which requires %ld bytes.",
+                          long(bufferSize), long(requiredSize));
+        return new QImage;
+    }
+    return image;
+}
+
+#if PY_VERSION_HEX >= 0x03000000 && !defined(Py_LIMITED_API)
+
+// QImage buffer protocol functions, exporting the pixels as an array of
+// shape (height, width, bytes per pixel) or (height, width) for formats
+// of 8 or 16 bits per pixel, with the lines bytesPerLine apart.
+// see: http://www.python.org/dev/peps/pep-3118/
+
+extern "C" {
+
+struct SbkQImageBuffer
+{
+    // Holds a reference to the image data, which keeps the memory alive even
+    // if the wrapped image is modified or destroyed while the view exists.
+    // Since it shares the data, modifying the image through its own API detaches
+    // it from the view: writes through the view reach the image until then.
+    QImage image;
+    Py_ssize_t shape[3];
+    Py_ssize_t strides[3];
+};
+
+static int SbkQImage_getbufferproc(PyObject* self, Py_buffer* view, int flags)
+{
+    view->obj = 0;
+    if (!Shiboken::Object::isValid(self))
+        return -1;
+
+    QImage* cppSelf = %CONVERTTOCPP[QImage*](self);
+    // Read-only unless write access is requested, which requires unshared data, as for
+    // QByteArray. An unshared image that still has to copy its data for that wraps
+    // read-only memory, such as that of a bytes object, and is not exported for writing.
+    const bool writable = (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE;
+    uchar* data = const_cast<uchar*>(cppSelf->constBits());
+    if (writable) {
+        const bool detached = cppSelf->isDetached();
+        const uchar* sharedData = data;
+        data = cppSelf->bits();
+        if (detached && data != sharedData) {
+            PyErr_SetString(PyExc_BufferError, "The QImage wraps read-only data.");
+            return -1;
+        }
+    }
+    SbkQImageBuffer* buffer = new SbkQImageBuffer;
+    buffer->image = *cppSelf;
+
+    const int depth = cppSelf->depth();
+    const Py_ssize_t bytesPerLine = cppSelf->bytesPerLine();
+    const char* format = "B";
+    int ndim = 2;
+    buffer->shape[0] = cppSelf->height();
+    buffer->strides[0] = bytesPerLine;
+    if (depth % 8 != 0) {
+        // Monochrome images are exported as the bytes of their lines.
+        buffer->shape[1] = bytesPerLine;
+        buffer->strides[1] = 1;
+    } else if (depth == 16) {
+        format = "H";
+        buffer->shape[1] = cppSelf->width();
+        buffer->strides[1] = 2;
+    } else {
+        const int bytesPerPixel = depth / 8;
+        buffer->shape[1] = cppSelf->width();
+        buffer->strides[1] = bytesPerPixel;
+        if (bytesPerPixel > 1) {
+            ndim = 3;
+            buffer->shape[2] = bytesPerPixel;
+            buffer->strides[2] = 1;
+        }
+    }
+    const bool withShape = (flags & PyBUF_ND) == PyBUF_ND;
+    const bool contiguous = buffer->shape[1] * buffer->strides[1] == bytesPerLine;
+    if (withShape && !contiguous && (flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
+        delete buffer;
+        PyErr_SetString(PyExc_BufferError, "The lines of the QImage are padded, a strided buffer is required.");
+        return -1;
+    }
+
+    view->buf = data;
+    view->readonly = writable ? 0 : 1;
+    view->itemsize = depth == 16 ? 2 : 1;
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>(format) : 0;
+    // Consumers not asking for the shape see all lines as contiguous bytes.
+    view->len = withShape && !contiguous
+        ? buffer->shape[0] * buffer->shape[1] * (ndim == 3 ? buffer->shape[2] : 1) * view->itemsize
+        : bytesPerLine * buffer->shape[0];
+    view->ndim = withShape ? ndim : 1;
+    view->shape = withShape ? buffer->shape : 0;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? buffer->strides : 0;
+    view->suboffsets = 0;
+    view->internal = buffer;
+    Py_INCREF(self);
+    view->obj = self;
+    return 0;
+}
+
+static void SbkQImage_releasebufferproc(PyObject*, Py_buffer* view)
+{
+    delete reinterpret_cast<SbkQImageBuffer*>(view->internal);
+    view->internal = 0;
+}
+
+static PyBufferProcs SbkQImageBufferProc = {
+    /*bf_getbuffer*/     &SbkQImage_getbufferproc,
+    /*bf_releasebuffer*/ &SbkQImage_releasebufferproc
+};
+
+}
+
+#endif
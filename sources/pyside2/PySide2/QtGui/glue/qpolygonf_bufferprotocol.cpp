@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#if PY_VERSION_HEX >= 0x03000000 && !defined(Py_LIMITED_API)
+
+// QPolygonF buffer protocol functions, exporting the points as a (count, 2) array of doubles
+// see: http://www.python.org/dev/peps/pep-3118/
+
+extern "C" {
+
+struct SbkQPolygonFBuffer
+{
+    // Holds a reference to the point data, which keeps the memory alive even
+    // if the wrapped polygon is modified or destroyed while the view exists.
+    QPolygonF polygon;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+};
+
+static int SbkQPolygonF_getbufferproc(PyObject* self, Py_buffer* view, int flags)
+{
+    view->obj = 0;
+    if (!Shiboken::Object::isValid(self))
+        return -1;
+    if (sizeof(QPointF) != 2 * sizeof(double)) {
+        PyErr_SetString(PyExc_BufferError, "The coordinates of QPolygonF are not doubles.");
+        return -1;
+    }
+
+    QPolygonF* cppSelf = %CONVERTTOCPP[QPolygonF*](self);
+    // Read-only unless write access is requested, which requires unshared data, as for QByteArray.
+    const bool writable = (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE;
+    QPointF* points = writable ? cppSelf->data() : const_cast<QPointF*>(cppSelf->constData());
+    SbkQPolygonFBuffer* buffer = new SbkQPolygonFBuffer;
+    buffer->polygon = *cppSelf;
+    buffer->shape[0] = cppSelf->size();
+    buffer->shape[1] = 2;
+    buffer->strides[0] = sizeof(QPointF);
+    buffer->strides[1] = sizeof(double);
+
+    view->buf = points;
+    view->len = buffer->shape[0] * sizeof(QPointF);
+    view->readonly = writable ? 0 : 1;
+    view->itemsize = sizeof(double);
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char*>("d") : 0;
+    // Consumers not asking for the shape see the points as contiguous bytes.
+    view->ndim = (flags & PyBUF_ND) == PyBUF_ND ? 2 : 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? buffer->shape : 0;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? buffer->strides : 0;
+    view->suboffsets = 0;
+    view->internal = buffer;
+    Py_INCREF(self);
+    view->obj = self;
+    return 0;
+}
+
+static void SbkQPolygonF_releasebufferproc(PyObject*, Py_buffer* view)
+{
+    delete reinterpret_cast<SbkQPolygonFBuffer*>(view->internal);
+    view->internal = 0;
+}
+
+static PyBufferProcs SbkQPolygonFBufferProc = {
+    /*bf_getbuffer*/     &SbkQPolygonF_getbufferproc,
+    /*bf_releasebuffer*/ &SbkQPolygonF_releasebufferproc
+};
+
+}
+
+#endif
@@ -80,8 +80,15 @@ macro(create_pyside_module
 
     get_filename_component(pyside_binary_dir ${CMAKE_CURRENT_BINARY_DIR} DIRECTORY)
 
+    set(shiboken_fastcall_option "")
+    list(FIND PYSIDE_FASTCALL_MODULES ${module_name} _fastcall_index)
+    if(NOT _fastcall_index EQUAL -1)
+        set(shiboken_fastcall_option "--enable-fastcall")
+    endif()
+
     add_custom_command(OUTPUT ${${module_sources}}
                         COMMAND "${SHIBOKEN_BINARY}" ${GENERATOR_EXTRA_FLAGS}
+                        ${shiboken_fastcall_option}
                         "${pyside2_BINARY_DIR}/${module_name}_global.h"
                         --include-paths=${shiboken_include_dirs}
                         ${shiboken_framework_include_dirs_option}
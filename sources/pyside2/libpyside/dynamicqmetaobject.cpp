@@ -44,14 +44,18 @@
 #include "pysideproperty.h"
 #include "pysideproperty_p.h"
 #include "pysideslot_p.h"
+#include "metamethodconverters_p.h"
+#include "metamethodnames_p.h"
 
 #include <QByteArray>
 #include <QString>
 #include <QStringList>
+#include <QHash>
 #include <QList>
-#include <QLinkedList>
+#include <QPair>
 #include <QObject>
 #include <cstring>
+#include <algorithm>
 #include <QDebug>
 #include <QMetaMethod>
 #include <shiboken.h>
@@ -106,27 +110,51 @@ enum MetaDataFlags {
 class DynamicQMetaObject::DynamicQMetaObjectPrivate
 {
 public:
+    typedef QPair<int, QByteArray> MethodKey;
+
     QList<MethodData> m_methods;
+    // Positions in m_methods by method type and signature.
+    QHash<MethodKey, int> m_methodPositions;
+    // Positions of removed methods, reused by the next added ones.
+    QList<int> m_blankMethods;
     QList<PropertyData> m_properties;
 
     QMap<QByteArray, QByteArray> m_info;
     QByteArray m_className;
+    // Interned Python names by method index, see DynamicQMetaObject::methodName().
+    QHash<int, PyObject*> m_methodNames;
+    // The strings of the meta data, only ever appended to, and their indexes.
+    QList<QByteArray> m_strings;
+    QHash<QByteArray, int> m_stringIndexes;
+    int m_writtenStrings; // strings already in the string data
+    int m_stringCapacity; // strings the string data has room for
+    int m_stringDataSize; // characters in the string data
+    int m_stringDataCapacity;
     bool m_updated; // when the meta data is not update
+    bool m_layoutChanged; // when more than appending methods happened since the last update
+    bool m_unresolvedNotify; // when a property notify signal was missing at the last update
     int m_methodOffset;
     int m_propertyOffset;
     int m_dataSize;
-    int m_emptyMethod;
+    int m_dataCapacity;
+    int m_methodsIndex; // where the method entries start in the data
+    int m_methodCapacity; // method entries the data has room for
+    int m_writtenMethods; // methods already in the data
     int m_nullIndex;
 
     DynamicQMetaObjectPrivate()
-        : m_updated(false), m_methodOffset(0), m_propertyOffset(0),
-          m_dataSize(0), m_emptyMethod(-1), m_nullIndex(0) {}
+        : m_writtenStrings(0), m_stringCapacity(0), m_stringDataSize(0), m_stringDataCapacity(0),
+          m_updated(false), m_layoutChanged(true), m_unresolvedNotify(false),
+          m_methodOffset(0), m_propertyOffset(0), m_dataSize(0), m_dataCapacity(0),
+          m_methodsIndex(0), m_methodCapacity(0), m_writtenMethods(0), m_nullIndex(0) {}
 
-    int createMetaData(QMetaObject* metaObj, QLinkedList<QByteArray> &strings);
+    int registerString(const QByteArray& s);
+    int writeMethod(uint* data, int entryIndex, int paramsIndex, const MethodData& method);
     void updateMetaObject(QMetaObject* metaObj);
-    void writeMethodsData(const QList<MethodData>& methods, unsigned int** data, QLinkedList<QByteArray>& strings, int* prtIndex, int nullIndex, int flags);
-    void writeStringData(char *,  QLinkedList<QByteArray> &strings);
+    bool appendMethods(QMetaObject* metaObj);
+    bool writeStringData(QMetaObject* metaObj);
     int getPropertyNotifyId(PySideProperty *property) const;
+    void clearMethodNames();
 };
 
 bool sortMethodSignalSlot(const MethodData &m1, const MethodData &m2)
@@ -136,39 +164,6 @@ bool sortMethodSignalSlot(const MethodData &m1, const MethodData &m2)
     return false;
 }
 
-static int registerString(const QByteArray& s, QLinkedList<QByteArray>& strings)
-{
-    int idx = 0;
-    QLinkedList<QByteArray>::const_iterator it = strings.begin();
-    QLinkedList<QByteArray>::const_iterator itEnd = strings.end();
-    while (it != itEnd) {
-        if (strcmp(*it, s) == 0)
-            return idx;
-        ++idx;
-        ++it;
-    }
-    strings.append(s);
-    return idx;
-}
-
-static int blobSize(QLinkedList<QByteArray> &strings)
-{
-   int size = strings.size() * sizeof(QByteArrayData);
-
-   QByteArray str;
-   QByteArray debug_str;
-   foreach (const QByteArray &field, strings) {
-      str.append(field);
-      str.append(char(0));
-
-      debug_str.append(field);
-      debug_str.append('|');
-   }
-   //qDebug()<<debug_str;
-   size += str.size();
-   return size;
-}
-
 static int aggregateParameterCount(const QList<MethodData> &methods)
 {
    int sum = 0;
@@ -391,6 +386,7 @@ DynamicQMetaObject::DynamicQMetaObject(PyTypeObject* type, const QMetaObject* ba
     m_d->m_className = QByteArray(type->tp_name).split('.').last();
     m_d->m_methodOffset = base->methodCount() - 1;
     m_d->m_propertyOffset = base->propertyCount() - 1;
+    MetaMethodConverters::registerDynamicMetaObject(this);
     parsePythonType(type);
 }
 
@@ -407,10 +403,14 @@ DynamicQMetaObject::DynamicQMetaObject(const char* className, const QMetaObject*
     m_d->m_className = className;
     m_d->m_methodOffset = metaObject->methodCount() - 1;
     m_d->m_propertyOffset = metaObject->propertyCount() - 1;
+    MetaMethodConverters::registerDynamicMetaObject(this);
 }
 
 DynamicQMetaObject::~DynamicQMetaObject()
 {
+    MetaMethodConverters::unregisterDynamicMetaObject(this);
+    MetaMethodNames::invalidate(this);
+    m_d->clearMethodNames();
     free(reinterpret_cast<char *>(const_cast<QByteArrayData *>(d.stringdata)));
     free(const_cast<uint*>(d.data));
     delete m_d;
@@ -418,18 +418,10 @@ DynamicQMetaObject::~DynamicQMetaObject()
 
 int DynamicQMetaObject::addMethod(QMetaMethod::MethodType mtype, const char* signature, const char* type)
 {
-    int index = -1;
-    int counter = 0;
-
-    QList<MethodData>::iterator it = m_d->m_methods.begin();
-    for (; it != m_d->m_methods.end(); ++it) {
-        if ((it->signature() == signature) && (it->methodType() == mtype))
-            return m_d->m_methodOffset + counter;
-        else if (!it->isValid()) {
-            index = counter;
-        }
-        counter++;
-    }
+    const DynamicQMetaObjectPrivate::MethodKey key(mtype, QByteArray::fromRawData(signature, int(qstrlen(signature))));
+    QHash<DynamicQMetaObjectPrivate::MethodKey, int>::const_iterator it = m_d->m_methodPositions.constFind(key);
+    if (it != m_d->m_methodPositions.constEnd())
+        return m_d->m_methodOffset + it.value() + 1;
 
     // Common mistake not to add parentheses to the signature.
     if ((strchr(signature, ')') == 0) || ((strchr(signature, '(') == 0))) {
@@ -442,28 +434,34 @@ int DynamicQMetaObject::addMethod(QMetaMethod::MethodType mtype, const char* sig
     }
 
     //has blank method
-    if (index != -1) {
-        m_d->m_methods[index] = MethodData(mtype, signature, type);
-        index++;
+    int index;
+    const MethodData method(mtype, signature, type);
+    if (!m_d->m_blankMethods.isEmpty()) {
+        QList<int>::iterator blank = std::max_element(m_d->m_blankMethods.begin(), m_d->m_blankMethods.end());
+        index = *blank;
+        m_d->m_blankMethods.erase(blank);
+        m_d->m_methods[index] = method;
+        m_d->m_layoutChanged = true;
     } else {
-        m_d->m_methods << MethodData(mtype, signature, type);
         index = m_d->m_methods.size();
+        m_d->m_methods << method;
     }
+    m_d->m_methodPositions.insert(DynamicQMetaObjectPrivate::MethodKey(mtype, method.signature()), index);
 
     m_d->m_updated = false;
-    return m_d->m_methodOffset + index;
+    return m_d->m_methodOffset + index + 1;
 }
 
 void DynamicQMetaObject::removeMethod(QMetaMethod::MethodType mtype, uint index)
 {
-    const char* methodSig = method(index).methodSignature();
-    QList<MethodData>::iterator it = m_d->m_methods.begin();
-    for (; it != m_d->m_methods.end(); ++it) {
-        if ((it->signature() == methodSig) && (it->methodType() == mtype)){
-            it->clear();
-            m_d->m_updated = false;
-            break;
-        }
+    const DynamicQMetaObjectPrivate::MethodKey key(mtype, method(index).methodSignature());
+    QHash<DynamicQMetaObjectPrivate::MethodKey, int>::iterator it = m_d->m_methodPositions.find(key);
+    if (it != m_d->m_methodPositions.end()) {
+        m_d->m_methods[it.value()].clear();
+        m_d->m_blankMethods << it.value();
+        m_d->m_methodPositions.erase(it);
+        m_d->m_layoutChanged = true;
+        m_d->m_updated = false;
     }
 }
 
@@ -506,6 +504,7 @@ int DynamicQMetaObject::addProperty(const char* propertyName, PyObject* data)
         m_d->m_properties << PropertyData(propertyName, notifyId, property);
         index = m_d->m_properties.size();
     }
+    m_d->m_layoutChanged = true;
     m_d->m_updated = false;
     return  m_d->m_propertyOffset + index;
 }
@@ -516,8 +515,8 @@ int DynamicQMetaObject::DynamicQMetaObjectPrivate::getPropertyNotifyId(PySidePro
     if (property->d->notify) {
         const char *signalNotify = PySide::Property::getNotifyName(property);
         if (signalNotify) {
-            const MethodData signalObject(QMetaMethod::Signal, signalNotify, "");
-            notifyId = m_methods.indexOf(signalObject);
+            const MethodKey key(QMetaMethod::Signal, QMetaObject::normalizedSignature(signalNotify));
+            notifyId = m_methodPositions.value(key, -1);
         }
     }
     return notifyId;
@@ -526,6 +525,7 @@ int DynamicQMetaObject::DynamicQMetaObjectPrivate::getPropertyNotifyId(PySidePro
 void DynamicQMetaObject::addInfo(const char* key, const char* value)
 {
     m_d->m_info[key] = value;
+    m_d->m_layoutChanged = true;
 }
 
 void DynamicQMetaObject::addInfo(QMap<QByteArray, QByteArray> info)
@@ -535,53 +535,98 @@ void DynamicQMetaObject::addInfo(QMap<QByteArray, QByteArray> info)
         m_d->m_info[i.key()] = i.value();
         ++i;
     }
+    m_d->m_layoutChanged = true;
     m_d->m_updated = false;
 }
 
 const QMetaObject* DynamicQMetaObject::update() const
 {
     if (!m_d->m_updated) {
-        m_d->updateMetaObject(const_cast<DynamicQMetaObject*>(this));
+        QMetaObject* metaObj = const_cast<DynamicQMetaObject*>(this);
+        MetaMethodNames::invalidate(this);
+        // Methods added since the last update are appended to the meta data, which leaves the
+        // existing methods, and what is cached about them, untouched.
+        if (!m_d->appendMethods(metaObj)) {
+            MetaMethodConverters::invalidate(this);
+            m_d->clearMethodNames();
+            m_d->updateMetaObject(metaObj);
+        }
+        // The converters keep type names pointing into the string data.
+        if (m_d->writeStringData(metaObj))
+            MetaMethodConverters::invalidate(this);
         m_d->m_updated = true;
     }
     return this;
 }
 
-void DynamicQMetaObject::DynamicQMetaObjectPrivate::writeMethodsData(const QList<MethodData>& methods,
-                                                                     unsigned int** data,
-                                                                     QLinkedList<QByteArray>& strings,
-                                                                     int* prtIndex,
-                                                                     int nullIndex,
-                                                                     int flags)
+PyObject* DynamicQMetaObject::methodName(int index) const
 {
-    int index = *prtIndex;
-    int paramsIndex = index + methods.count() * 5;
+    PyObject*& name = m_d->m_methodNames[index];
+    if (!name) {
+        const QByteArray methodName = method(index).name();
+#ifdef IS_PY3K
+        name = PyUnicode_InternFromString(methodName.constData());
+#else
+        name = PyString_InternFromString(methodName.constData());
+#endif
+    }
+    return name;
+}
 
-    QList<MethodData>::const_iterator it = methods.begin();
+void DynamicQMetaObject::DynamicQMetaObjectPrivate::clearMethodNames()
+{
+    if (m_methodNames.isEmpty())
+        return;
+    Shiboken::GilState gil;
+    foreach (PyObject* name, m_methodNames)
+        Py_XDECREF(name);
+    m_methodNames.clear();
+}
 
-    if (m_emptyMethod == -1)
-        m_emptyMethod = registerString(EMPTY_META_METHOD, strings);
+int DynamicQMetaObject::DynamicQMetaObjectPrivate::registerString(const QByteArray& s)
+{
+    QHash<QByteArray, int>::const_iterator it = m_stringIndexes.constFind(s);
+    if (it != m_stringIndexes.constEnd())
+        return it.value();
+    const int index = m_strings.size();
+    m_strings.append(s);
+    m_stringIndexes.insert(s, index);
+    return index;
+}
 
-    for (; it != methods.end(); ++it) {
-        int name_idx = 0;
-        int argc = it->parameterCount();
-        if (it->signature() != EMPTY_META_METHOD)
-           name_idx = registerString(it->name(), strings);
+/*!
+  Writes the entry of \p method at \p entryIndex, and its return and parameter types and
+  parameter names at \p paramsIndex.
+  Returns the size of the latter.
+*/
+int DynamicQMetaObject::DynamicQMetaObjectPrivate::writeMethod(uint* data, int entryIndex, int paramsIndex,
+                                                               const MethodData& method)
+{
+    const QList<QByteArray> paramTypeNames = method.parameterTypes();
+    const int argc = paramTypeNames.size();
+
+    data[entryIndex++] = registerString(method.isValid() ? method.name() : QByteArray(EMPTY_META_METHOD)); // func name
+    data[entryIndex++] = argc; // argc (previously: arg name)
+    data[entryIndex++] = paramsIndex; //parameter index
+    data[entryIndex++] = m_nullIndex; // tags
+    data[entryIndex++] = AccessPublic | (method.methodType() == QMetaMethod::Signal ? MethodSignal : MethodSlot);
+
+    int index = paramsIndex;
+    for (int i = -1; i < argc; ++i) {
+        const QByteArray &typeName = (i < 0) ? method.returnType() : paramTypeNames.at(i);
+        int typeInfo;
+        if (QtPrivate::isBuiltinType(typeName))
+            typeInfo = QMetaType::type(typeName);
         else
-           name_idx = m_emptyMethod; // func name
-
-        (*data)[index++] = name_idx;
-        (*data)[index++] = argc; // argc (previously: arg name)
-        (*data)[index++] = paramsIndex; //parameter index
-        (*data)[index++] = nullIndex; // tags
-        (*data)[index++] = flags  |  (it->methodType() == QMetaMethod::Signal ? MethodSignal : MethodSlot);
+            typeInfo = IsUnresolvedType | registerString(typeName);
+        data[index++] = typeInfo;
+    }
 
-        if (it->methodType() == QMetaMethod::Signal)
-           (*data)[13] += 1; //signal count
+    // Parameter names (use a null string)
+    for (int i = 0; i < argc; ++i)
+        data[index++] = m_nullIndex;
 
-        paramsIndex += 1 + argc * 2;
-    }
-    *prtIndex = index;
+    return index - paramsIndex;
 }
 
 void DynamicQMetaObject::parsePythonType(PyTypeObject *type)
@@ -682,60 +727,83 @@ void DynamicQMetaObject::parsePythonType(PyTypeObject *type)
 }
 
 /*!
-  Allocate the meta data table.
-  Returns the index in the table corresponding to the header fields count.
+  Appends the methods added since the last update to the meta data table, into the room left
+  for them by updateMetaObject().
+  Returns false when that does not work out and the table has to be written anew.
 */
-int DynamicQMetaObject::DynamicQMetaObjectPrivate::createMetaData(QMetaObject* metaObj, QLinkedList<QByteArray> &strings)
+bool DynamicQMetaObject::DynamicQMetaObjectPrivate::appendMethods(QMetaObject* metaObj)
 {
+    uint* data = const_cast<uint*>(metaObj->d.data);
     const int n_methods = m_methods.size();
-    const int n_properties = m_properties.size();
-    const int n_info = m_info.size();
-
-    int header[] = {7,                  // revision (Used by moc, qmetaobjectbuilder and qdbus)
-                    0,                  // class name index in m_metadata
-                    n_info, 0,          // classinfo and classinfo index
-                    n_methods, 0,       // method count and method list index
-                    n_properties, 0,    // prop count and prop indexes
-                    0, 0,               // enum count and enum index
-                    0, 0,               // constructors (since revision 2)
-                    0,                  // flags (since revision 3)
-                    0};                 // signal count (since revision 4)
-
-    const int HEADER_LENGHT = sizeof(header)/sizeof(int);
-
-    m_dataSize = HEADER_LENGHT;
-    m_dataSize += n_info*2;        //class info: name, value
-    m_dataSize += n_methods*5;     //method: name, argc, parameters, tag, flags
-    m_dataSize += n_properties*4;  //property: name, type, flags
-    m_dataSize += 1;               //eod
-
-    m_dataSize += aggregateParameterCount(m_methods); // types and parameter names
-
-    uint* data = reinterpret_cast<uint*>(realloc(const_cast<uint*>(metaObj->d.data), m_dataSize * sizeof(uint)));
-
-    Q_ASSERT(data);
-    std::memcpy(data, header, sizeof(header));
-
-    metaObj->d.data = data;
-
-    return HEADER_LENGHT;
-}
+    if (!data || m_layoutChanged || n_methods > m_methodCapacity)
+        return false;
+
+    int signalCount = data[13];
+    int paramsSize = 0;
+    for (int i = m_writtenMethods; i < n_methods; ++i) {
+        const MethodData& method = m_methods.at(i);
+        if (method.methodType() == QMetaMethod::Signal) {
+            // Signals must stay ahead of the slots, and may be the notify signal of a property.
+            if (signalCount != i || m_unresolvedNotify)
+                return false;
+            ++signalCount;
+        }
+        paramsSize += method.parameterCount() * 2 + 1;
+    }
+    if (m_dataSize + paramsSize > m_dataCapacity)
+        return false;
+
+    // The parameters go where the end of data marker was.
+    int paramsIndex = m_dataSize - 1;
+    for (int i = m_writtenMethods; i < n_methods; ++i)
+        paramsIndex += writeMethod(data, m_methodsIndex + i * 5, paramsIndex, m_methods.at(i));
+    data[paramsIndex++] = 0; // the end
+
+    data[4] = n_methods;
+    data[5] = m_methodsIndex;
+    data[13] = signalCount;
+    m_dataSize = paramsIndex;
+    m_writtenMethods = n_methods;
+    return true;
+}
+
+// Writes the strings registered since the last call to the string data, which consists of an
+// array of QByteArrayData followed by a char array containing the actual strings. This format
+// must match the one produced by moc (see generator.cpp).
+// Both parts have room to grow, the string data is only moved once that is used up.
+// Returns true when it was moved.
+bool DynamicQMetaObject::DynamicQMetaObjectPrivate::writeStringData(QMetaObject* metaObj)
+{
+    const int count = m_strings.size();
+    if (m_writtenStrings == count)
+        return false;
+
+    int size = 0;
+    for (int i = m_writtenStrings; i < count; ++i)
+        size += m_strings.at(i).size() + 1;
+
+    char* out = reinterpret_cast<char*>(const_cast<QByteArrayData*>(metaObj->d.stringdata));
+    const bool moved = count > m_stringCapacity || m_stringDataSize + size > m_stringDataCapacity;
+    if (moved) {
+        free(out);
+        m_writtenStrings = 0;
+        m_stringDataSize = 0;
+        size = 0;
+        foreach (const QByteArray& str, m_strings)
+            size += str.size() + 1;
+        m_stringCapacity = qMax(2 * count, 16);
+        m_stringDataCapacity = qMax(2 * size, 256);
+        out = reinterpret_cast<char*>(malloc(m_stringCapacity * sizeof(QByteArrayData) + m_stringDataCapacity));
+    }
+    Q_ASSERT(!(reinterpret_cast<quintptr>(out) & (Q_ALIGNOF(QByteArrayData)-1)));
 
-// Writes strings to string data struct.
-// The struct consists of an array of QByteArrayData, followed by a char array
-// containing the actual strings. This format must match the one produced by
-// moc (see generator.cpp).
-void DynamicQMetaObject::DynamicQMetaObjectPrivate::writeStringData(char *out,  QLinkedList<QByteArray> &strings)
-{
-   Q_ASSERT(!(reinterpret_cast<quintptr>(out) & (Q_ALIGNOF(QByteArrayData)-1)));
+    const int offsetOfStringdataMember = m_stringCapacity * sizeof(QByteArrayData);
+    for (int i = m_writtenStrings; i < count; ++i)
+        writeString(out, i, m_strings.at(i), offsetOfStringdataMember, m_stringDataSize);
+    m_writtenStrings = count;
 
-   int offsetOfStringdataMember = strings.size() * sizeof(QByteArrayData);
-   int stringdataOffset = 0;
-   int i = 0;
-   foreach(const QByteArray& str, strings) {
-      writeString(out, i, str, offsetOfStringdataMember, stringdataOffset);
-      i++;
-   }
+    metaObj->d.stringdata = reinterpret_cast<const QByteArrayData *>(out);
+    return moved;
 }
 
 QList<MethodData>::iterator is_sorted_until(QList<MethodData>::iterator first,
@@ -759,31 +827,55 @@ bool is_sorted(QList<MethodData>::iterator first, QList<MethodData>::iterator la
     return is_sorted_until(first, last, comp) == last;
 }
 
+/*!
+  Writes the meta data table anew. Methods are followed by room for more of them, and their
+  parameters come last, so that appendMethods() can add methods without moving the rest.
+*/
 void DynamicQMetaObject::DynamicQMetaObjectPrivate::updateMetaObject(QMetaObject* metaObj)
 {
     Q_ASSERT(!m_updated);
-    uint *data = const_cast<uint*>(metaObj->d.data);
-    int index = 0;
-    QLinkedList<QByteArray> strings;
-    m_dataSize = 0;
+    const int n_methods = m_methods.size();
+    const int n_properties = m_properties.size();
+    const int n_info = m_info.size();
+    const int paramsSize = aggregateParameterCount(m_methods); // types and parameter names
+
+    int header[] = {7,                  // revision (Used by moc, qmetaobjectbuilder and qdbus)
+                    0,                  // class name index in m_metadata
+                    n_info, 0,          // classinfo and classinfo index
+                    n_methods, 0,       // method count and method list index
+                    n_properties, 0,    // prop count and prop indexes
+                    0, 0,               // enum count and enum index
+                    0, 0,               // constructors (since revision 2)
+                    0,                  // flags (since revision 3)
+                    0};                 // signal count (since revision 4)
+
+    const int HEADER_LENGHT = sizeof(header)/sizeof(int);
 
-    // Recompute the size and reallocate memory
-    // index is set after the last header field.
-    index = createMetaData(metaObj, strings);
-    data = const_cast<uint*>(metaObj->d.data);
+    m_methodCapacity = qMax(2 * n_methods, 8);
+    m_dataSize = HEADER_LENGHT;
+    m_dataSize += n_info*2;                 //class info: name, value
+    m_dataSize += m_methodCapacity*5;       //method: name, argc, parameters, tag, flags
+    m_dataSize += n_properties*4;           //property: name, type, flags, notify
+    m_dataSize += paramsSize;
+    m_dataSize += 1;                        //eod
+    m_dataCapacity = m_dataSize + qMax(paramsSize, 32);
+
+    uint* data = reinterpret_cast<uint*>(realloc(const_cast<uint*>(metaObj->d.data), m_dataCapacity * sizeof(uint)));
+    Q_ASSERT(data);
+    std::memcpy(data, header, sizeof(header));
+    int index = HEADER_LENGHT;
 
-    registerString(m_className, strings); // register class string
-    m_nullIndex = registerString("", strings); // register a null string
+    registerString(m_className); // register class string, always the first one
+    m_nullIndex = registerString(""); // register a null string
 
     // Write class info.
     if (m_info.size()) {
-        if (data[3] == 0)
-            data[3] = index;
+        data[3] = index;
 
         QMap<QByteArray, QByteArray>::const_iterator i = m_info.constBegin(); //TODO: info is a hash this can fail
         while (i != m_info.constEnd()) {
-            int valueIndex = registerString(i.value(), strings);
-            int keyIndex = registerString(i.key(), strings);
+            int valueIndex = registerString(i.value());
+            int keyIndex = registerString(i.key());
             data[index++] = keyIndex;
             data[index++] = valueIndex;
             i++;
@@ -821,44 +913,30 @@ void DynamicQMetaObject::DynamicQMetaObjectPrivate::updateMetaObject(QMetaObject
         PyErr_Clear();
     }
 
-    if (m_methods.size()) {
-        if (data[5] == 0)
-            data[5] = index;
-
-        writeMethodsData(m_methods, &data, strings, &index, m_nullIndex, AccessPublic);
-    }
-
-    // Write signal/slots parameters.
-    if (m_methods.size()) {
-       for (it = m_methods.begin(); it != m_methods.end(); ++it) {
-          QList<QByteArray> paramTypeNames = it->parameterTypes();
-          int paramCount = paramTypeNames.size();
-          for (int i = -1; i < paramCount; ++i) {
-             const QByteArray &typeName = (i < 0) ? it->returnType() : paramTypeNames.at(i);
-             int typeInfo;
-             if (QtPrivate::isBuiltinType(typeName))
-                typeInfo = QMetaType::type(typeName);
-             else
-                typeInfo = IsUnresolvedType | registerString(typeName, strings);
-             data[index++] = typeInfo;
-          }
-
-          // Parameter names (use a null string)
-          for (int i = 0; i < paramCount; ++i) {
-             data[index++] = m_nullIndex;
-          }
-       }
+    // Write signal/slots and their parameters, which go after the properties.
+    m_methodsIndex = index;
+    const int propertiesIndex = m_methodsIndex + m_methodCapacity * 5;
+    int paramsIndex = propertiesIndex + n_properties * 4;
+    if (n_methods)
+        data[5] = m_methodsIndex;
+    for (int i = 0; i < n_methods; ++i) {
+        const MethodData& method = m_methods.at(i);
+        paramsIndex += writeMethod(data, m_methodsIndex + i * 5, paramsIndex, method);
+        if (method.methodType() == QMetaMethod::Signal)
+           data[13] += 1; //signal count
     }
+    m_writtenMethods = n_methods;
 
     // Write properties.
+    index = propertiesIndex;
+    m_unresolvedNotify = false;
     if (m_properties.size()) {
-        if (data[7] == 0)
-            data[7] = index;
+        data[7] = index;
 
         QList<PropertyData>::const_iterator i = m_properties.constBegin();
         while (i != m_properties.constEnd()) {
             if (i->isValid()) {
-                data[index++] = registerString(i->name(), strings); // name
+                data[index++] = registerString(i->name()); // name
             } else
                 data[index++] = m_nullIndex;
 
@@ -869,7 +947,7 @@ void DynamicQMetaObject::DynamicQMetaObjectPrivate::updateMetaObject(QMetaObject
                 if (QtPrivate::isBuiltinType(typeName))
                    typeInfo = QMetaType::type(typeName);
                 else
-                   typeInfo = IsUnresolvedType | registerString(typeName, strings);
+                   typeInfo = IsUnresolvedType | registerString(typeName);
             }
             data[index++] = typeInfo; // normalized type
 
@@ -883,19 +961,16 @@ void DynamicQMetaObject::DynamicQMetaObjectPrivate::updateMetaObject(QMetaObject
             // Recompute notifyId, because sorting the methods might have changed the relative
             // index.
             const int notifyId = getPropertyNotifyId(i->data());
+            if (notifyId < 0 && i->data()->d->notify)
+                m_unresolvedNotify = true;
             data[index++] = notifyId >= 0 ? static_cast<uint>(notifyId) : 0; //signal notify index
             i++;
         }
     }
 
-    data[index++] = 0; // the end
-
-    // Create the m_metadata string.
-    int size = blobSize(strings);
-    char *blob =
-        reinterpret_cast<char *>(realloc(reinterpret_cast<char *>(const_cast<QByteArrayData *>(metaObj->d.stringdata)), size));
-    writeStringData(blob, strings);
+    Q_ASSERT(paramsIndex == m_dataSize - 1);
+    data[paramsIndex] = 0; // the end
 
-    metaObj->d.stringdata = reinterpret_cast<const QByteArrayData *>(blob);
     metaObj->d.data = data;
+    m_layoutChanged = false;
 }
@@ -70,6 +70,12 @@ public:
 
     const QMetaObject* update() const;
 
+    /**
+     * Returns the name of the method \p index as an interned Python string,
+     * created on first use and owned by the meta object.
+     */
+    PyObject* methodName(int index) const;
+
 private:
     class DynamicQMetaObjectPrivate;
     DynamicQMetaObjectPrivate* m_d;
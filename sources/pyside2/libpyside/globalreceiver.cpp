@@ -40,6 +40,7 @@
 #include "globalreceiver.h"
 #include "dynamicqmetaobject_p.h"
 #include "pysideweakref.h"
+#include "metamethodconverters_p.h"
 
 #include <QMetaMethod>
 #include <QDebug>
@@ -310,11 +311,10 @@ int GlobalReceiver::qt_metacall(QMetaObject::Call call, int id, void** args)
     if (m_shortCircuitSlots.contains(id)) {
         retval = data->call(reinterpret_cast<PyObject*>(args[1]));
     } else {
-        QList<QByteArray> paramTypes = slot.parameterTypes();
-        Shiboken::AutoDecRef preparedArgs(PyTuple_New(paramTypes.count()));
-        for (int i = 0, max = paramTypes.count(); i < max; ++i) {
-            const QByteArray& paramType = paramTypes[i];
-            Shiboken::Conversions::SpecificConverter converter(paramType.constData());
+        MetaMethodConvertersPtr converters = MetaMethodConverters::get(slot);
+        Shiboken::AutoDecRef preparedArgs(PyTuple_New(converters->parameterCount()));
+        for (int i = 0, max = converters->parameterCount(); i < max; ++i) {
+            Shiboken::Conversions::SpecificConverter& converter = converters->parameterConverter(i);
             PyTuple_SET_ITEM(preparedArgs.object(), i, converter.toPython(args[i+1]));
         }
         retval = data->call(preparedArgs);
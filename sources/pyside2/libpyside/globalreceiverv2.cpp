@@ -69,11 +69,11 @@ class DynamicSlotDataV2
         int addSlot(const char* signature);
         int id(const char* signature) const;
         PyObject* callback();
-        QByteArray hash() const;
+        GlobalReceiverKey key() const { return m_key; }
         void notify();
 
         static void onCallbackDestroyed(void* data);
-        static QByteArray hash(PyObject *callback);
+        static GlobalReceiverKey key(PyObject *callback);
 
 
     private:
@@ -84,7 +84,7 @@ class DynamicSlotDataV2
         PyObject* m_weakRef;
         QMap<QByteArray, int> m_signatures;
         GlobalReceiverV2* m_parent;
-        QByteArray m_hash;
+        GlobalReceiverKey m_key;
 };
 
 }
@@ -108,31 +108,24 @@ DynamicSlotDataV2::DynamicSlotDataV2(PyObject* callback, GlobalReceiverV2* paren
 
         //monitor class from method lifetime
         m_weakRef = WeakRef::create(m_pythonSelf, DynamicSlotDataV2::onCallbackDestroyed, this);
-
-        m_hash = QByteArray::number((qlonglong)PyObject_Hash(m_callback))
-                 + QByteArray::number((qlonglong)PyObject_Hash(m_pythonSelf));
-
     } else {
         m_callback = callback;
         Py_INCREF(m_callback);
-
-        m_hash = QByteArray::number((qlonglong)PyObject_Hash(m_callback));
     }
+    m_key = key(callback);
 }
 
-QByteArray DynamicSlotDataV2::hash() const
-{
-    return m_hash;
-}
-
-QByteArray DynamicSlotDataV2::hash(PyObject* callback)
+GlobalReceiverKey DynamicSlotDataV2::key(PyObject* callback)
 {
-    Shiboken::GilState gil;
+    // Bound methods are created on every attribute access, so they are told apart by what they bind.
     if (PyMethod_Check(callback))
-        return  QByteArray::number((qlonglong)PyObject_Hash(PyMethod_GET_FUNCTION(callback)))
-              + QByteArray::number((qlonglong)PyObject_Hash(PyMethod_GET_SELF(callback)));
-    else
-        return QByteArray::number((qlonglong)PyObject_Hash(callback));
+        return GlobalReceiverKey(PyMethod_GET_FUNCTION(callback), PyMethod_GET_SELF(callback));
+    // So are builtin methods such as list.append, which bind their C function to an instance.
+    if (PyCFunction_Check(callback)) {
+        const PyMethodDef* method = reinterpret_cast<PyCFunctionObject*>(callback)->m_ml;
+        return GlobalReceiverKey(reinterpret_cast<const PyObject*>(method), PyCFunction_GET_SELF(callback));
+    }
+    return GlobalReceiverKey(callback, 0);
 }
 
 PyObject* DynamicSlotDataV2::callback()
@@ -190,12 +183,12 @@ DynamicSlotDataV2::~DynamicSlotDataV2()
 }
 
 GlobalReceiverV2::GlobalReceiverV2(PyObject *callback, SharedMap map)
-    : QObject(0), m_metaObject(GLOBAL_RECEIVER_CLASS_NAME, &QObject::staticMetaObject), m_sharedMap(map)
+    : QObject(0), m_metaObject(GLOBAL_RECEIVER_CLASS_NAME, &QObject::staticMetaObject), m_refCount(1), m_sharedMap(map)
 {
     m_data = new DynamicSlotDataV2(callback, this);
     m_metaObject.addSlot(RECEIVER_DESTROYED_SLOT_NAME);
     m_metaObject.update();
-    m_refs.append(NULL);
+    m_refs.insert(0, 1);
 
 
     if (DESTROY_SIGNAL_ID == 0)
@@ -209,9 +202,16 @@ GlobalReceiverV2::GlobalReceiverV2(PyObject *callback, SharedMap map)
 
 GlobalReceiverV2::~GlobalReceiverV2()
 {
+    for (QHash<const QObject*, int>::const_iterator it = m_refs.cbegin(), end = m_refs.cend(); it != end; ++it) {
+        if (it.key())
+            unlinkSender(it.key());
+    }
     m_refs.clear();
+    m_refCount = 0;
     // Remove itself from map.
-    m_sharedMap->remove(m_data->hash());
+    QHash<GlobalReceiverKey, GlobalReceiverV2*>::iterator it = m_sharedMap->receivers.find(m_data->key());
+    if (it != m_sharedMap->receivers.end() && it.value() == this)
+        m_sharedMap->receivers.erase(it);
     // Suppress handling of destroyed() for objects whose last reference is contained inside
     // the callback object that will now be deleted. The reference could be a default argument,
     // a callback local variable, etc.
@@ -231,33 +231,36 @@ int GlobalReceiverV2::addSlot(const char* signature)
 
 void GlobalReceiverV2::incRef(const QObject* link)
 {
-    if (link) {
-        if (!m_refs.contains(link)) {
-            bool connected;
-            Py_BEGIN_ALLOW_THREADS
-            connected = QMetaObject::connect(link, DESTROY_SIGNAL_ID, this, DESTROY_SLOT_ID);
-            Py_END_ALLOW_THREADS
-            if (connected)
-                m_refs.append(link);
-            else
-                Q_ASSERT(false);
-        } else {
-            m_refs.append(link);
+    int& count = m_refs[link];
+    if (link && count == 0) {
+        bool connected;
+        Py_BEGIN_ALLOW_THREADS
+        connected = QMetaObject::connect(link, DESTROY_SIGNAL_ID, this, DESTROY_SLOT_ID);
+        Py_END_ALLOW_THREADS
+        if (!connected) {
+            Q_ASSERT(false);
+            m_refs.remove(link);
+            return;
         }
-    } else {
-        m_refs.append(NULL);
+        m_sharedMap->senders[link].insert(this);
     }
+    ++count;
+    ++m_refCount;
 }
 
 void GlobalReceiverV2::decRef(const QObject* link)
 {
-    if (m_refs.size() <= 0)
+    if (m_refCount <= 0)
         return;
 
-
-    m_refs.removeOne(link);
-    if (link) {
-        if (!m_refs.contains(link)) {
+    QHash<const QObject*, int>::iterator it = m_refs.find(link);
+    if (it == m_refs.end())
+        return;
+    --m_refCount;
+    if (--it.value() == 0) {
+        m_refs.erase(it);
+        if (link) {
+            unlinkSender(link);
             bool result;
             Py_BEGIN_ALLOW_THREADS
             result = QMetaObject::disconnect(link, DESTROY_SIGNAL_ID, this, DESTROY_SLOT_ID);
@@ -268,7 +271,7 @@ void GlobalReceiverV2::decRef(const QObject* link)
         }
     }
 
-    if (m_refs.size() == 0)
+    if (m_refCount == 0)
         Py_BEGIN_ALLOW_THREADS
         delete this;
         Py_END_ALLOW_THREADS
@@ -278,30 +281,42 @@ void GlobalReceiverV2::decRef(const QObject* link)
 int GlobalReceiverV2::refCount(const QObject* link) const
 {
     if (link)
-        return m_refs.count(link);
+        return m_refs.value(link);
 
-    return m_refs.size();
+    return m_refCount;
+}
+
+void GlobalReceiverV2::unlinkSender(const QObject* link)
+{
+    QHash<const QObject*, QSet<GlobalReceiverV2*> >::iterator it = m_sharedMap->senders.find(link);
+    if (it == m_sharedMap->senders.end())
+        return;
+    it.value().remove(this);
+    if (it.value().isEmpty())
+        m_sharedMap->senders.erase(it);
 }
 
 void GlobalReceiverV2::notify()
 {
-    QSet<const QObject*> objs = QSet<const QObject*>::fromList(m_refs);
+    const QList<const QObject*> objs = m_refs.keys();
     Py_BEGIN_ALLOW_THREADS
     foreach(const QObject* o, objs) {
+        if (!o)
+            continue;
         QMetaObject::disconnect(o, DESTROY_SIGNAL_ID, this, DESTROY_SLOT_ID);
         QMetaObject::connect(o, DESTROY_SIGNAL_ID, this, DESTROY_SLOT_ID);
     }
     Py_END_ALLOW_THREADS
 }
 
-QByteArray GlobalReceiverV2::hash() const
+GlobalReceiverKey GlobalReceiverV2::key() const
 {
-    return m_data->hash();
+    return m_data->key();
 }
 
-QByteArray GlobalReceiverV2::hash(PyObject* callback)
+GlobalReceiverKey GlobalReceiverV2::key(PyObject* callback)
 {
-    return DynamicSlotDataV2::hash(callback);
+    return DynamicSlotDataV2::key(callback);
 }
 
 const QMetaObject* GlobalReceiverV2::metaObject() const
@@ -328,11 +343,17 @@ int GlobalReceiverV2::qt_metacall(QMetaObject::Call call, int id, void** args)
     }
 
     if (id == DESTROY_SLOT_ID) {
-        if (m_refs.size() == 0)
+        if (m_refCount == 0)
             return -1;
         QObject *obj = *(QObject**)args[1];
         incRef(); //keep the object live (safe ref)
-        m_refs.removeAll(obj); // remove all refs to this object
+        // remove all refs to this object
+        QHash<const QObject*, int>::iterator it = m_refs.find(obj);
+        if (it != m_refs.end()) {
+            m_refCount -= it.value();
+            m_refs.erase(it);
+            unlinkSender(obj);
+        }
         decRef(); //remove the safe ref
     } else {
         bool isShortCuit = (strstr(slot.methodSignature(), "(") == 0);
@@ -44,6 +44,7 @@
 #include <QObject>
 #include <QHash>
 #include <QSet>
+#include <QPair>
 #include <QSharedPointer>
 #include <QLinkedList>
 #include <QByteArray>
@@ -56,7 +57,15 @@ namespace PySide
 class DynamicSlotDataV2;
 class GlobalReceiverV2;
 
-typedef QMap<QByteArray, GlobalReceiverV2 *> GlobalReceiverV2Map;
+/// Identifies a callback by its function and instance when it is a method, by itself otherwise.
+typedef QPair<const PyObject*, const PyObject*> GlobalReceiverKey;
+
+/// The global receivers by callback, and the receivers linked to each sender.
+struct GlobalReceiverV2Map
+{
+    QHash<GlobalReceiverKey, GlobalReceiverV2*> receivers;
+    QHash<const QObject*, QSet<GlobalReceiverV2*> > senders;
+};
 typedef QSharedPointer<GlobalReceiverV2Map> SharedMap;
 
 /**
@@ -122,24 +131,28 @@ public:
     int refCount(const QObject* link) const;
 
     /**
-     * Use to retrive the unique hash of this GlobalReceiver object
+     * Use to retrive the unique key of this GlobalReceiver object
      *
-     * @return  a string with a unique id based on GlobalReceiver contents
+     * @return  the identity of the callback of this GlobalReceiver object
      **/
-    QByteArray hash() const;
+    GlobalReceiverKey key() const;
 
     /**
-     * Use to retrive the unique hash of the PyObject based on GlobalReceiver rules
+     * Use to retrive the unique key of the PyObject based on GlobalReceiver rules
      *
-     * @param   callback The Python callable object used to calculate the id
-     * @return  a string with a unique id based on GlobalReceiver contents
+     * @param   callback The Python callable object used to calculate the key
+     * @return  the identity of the callback
      **/
-    static QByteArray hash(PyObject* callback);
+    static GlobalReceiverKey key(PyObject* callback);
 
 private:
+    void unlinkSender(const QObject* link);
+
     DynamicQMetaObject m_metaObject;
     DynamicSlotDataV2 *m_data;
-    QList<const QObject*> m_refs;
+    // Reference count per linked QObject, null for the references without a link.
+    QHash<const QObject*, int> m_refs;
+    int m_refCount;
     SharedMap m_sharedMap;
 };
 
@@ -0,0 +1,155 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "metamethodconverters_p.h"
+
+#include <QHash>
+#include <QMetaMethod>
+#include <QMetaObject>
+#include <QMetaType>
+#include <QSet>
+
+namespace PySide
+{
+
+// Converters by meta object and method index.
+typedef QHash<const QMetaObject*, QHash<int, MetaMethodConvertersPtr> > MetaMethodConvertersHash;
+typedef QSet<const QMetaObject*> MetaObjectSet;
+
+Q_GLOBAL_STATIC(MetaMethodConvertersHash, metaMethodConverters)
+Q_GLOBAL_STATIC(MetaObjectSet, dynamicMetaObjects)
+
+// Layout of QMetaObjectPrivate, the header of QMetaObject::d.data.
+enum MetaObjectHeader {
+    MetaObjectRevision = 0,
+    MetaObjectFlags = 12,
+    MetaObjectFlagsRevision = 3
+};
+
+// QMetaObjectPrivate::DynamicMetaObject, set by QMetaObjectBuilder and QML.
+static const uint DynamicMetaObjectFlag = 0x01;
+
+static unsigned int metaMethodConvertersGeneration = 0;
+
+MetaMethodConverters::TypeInfo::TypeInfo(const QByteArray& name)
+    : typeName(name),
+      converter(name.isEmpty() ? "void" : name.constData()),
+      metaType(name.isEmpty() ? 0 : QMetaType::type(name))
+{
+}
+
+Shiboken::Conversions::SpecificConverter& MetaMethodConverters::TypeInfo::resolveConverter()
+{
+    // There is nothing to resolve for methods without a return value.
+    if (!converter && !typeName.isEmpty())
+        converter = Shiboken::Conversions::SpecificConverter(typeName.constData());
+    return converter;
+}
+
+int MetaMethodConverters::TypeInfo::resolveMetaType()
+{
+    if (!metaType)
+        metaType = QMetaType::type(typeName);
+    return metaType;
+}
+
+MetaMethodConverters::MetaMethodConverters(const QMetaMethod& method)
+{
+    const QByteArray returnType = method.typeName();
+    m_types.push_back(TypeInfo(returnType == "void" ? QByteArray() : returnType));
+    const QList<QByteArray> parameterTypes = method.parameterTypes();
+    m_types.reserve(parameterTypes.size() + 1);
+    for (const QByteArray& parameterType : parameterTypes)
+        m_types.push_back(TypeInfo(parameterType));
+}
+
+MetaMethodConvertersPtr MetaMethodConverters::get(const QMetaMethod& method)
+{
+    const QMetaObject* metaObject = method.enclosingMetaObject();
+    if (!isCacheable(metaObject))
+        return MetaMethodConvertersPtr(new MetaMethodConverters(method));
+    MetaMethodConvertersPtr& converters = (*metaMethodConverters())[metaObject][method.methodIndex()];
+    if (!converters)
+        converters.reset(new MetaMethodConverters(method));
+    return converters;
+}
+
+bool MetaMethodConverters::isCacheable(const QMetaObject* metaObject)
+{
+    if (dynamicMetaObjects()->contains(metaObject))
+        return true;
+    // The meta objects of others that are built at runtime are not reported to invalidate(),
+    // so their address may be reused by a different meta object.
+    const uint* data = metaObject->d.data;
+    return data && data[MetaObjectRevision] >= MetaObjectFlagsRevision
+        && !(data[MetaObjectFlags] & DynamicMetaObjectFlag);
+}
+
+void MetaMethodConverters::registerDynamicMetaObject(const QMetaObject* metaObject)
+{
+    dynamicMetaObjects()->insert(metaObject);
+}
+
+void MetaMethodConverters::unregisterDynamicMetaObject(const QMetaObject* metaObject)
+{
+    if (dynamicMetaObjects.isDestroyed())
+        return;
+    invalidate(metaObject);
+    dynamicMetaObjects()->remove(metaObject);
+}
+
+void MetaMethodConverters::invalidate(const QMetaObject* metaObject)
+{
+    if (metaMethodConverters.isDestroyed())
+        return;
+    MetaMethodConvertersHash* cache = metaMethodConverters();
+    MetaMethodConvertersHash::iterator it = cache->find(metaObject);
+    if (it != cache->end()) {
+        cache->erase(it);
+        ++metaMethodConvertersGeneration;
+    }
+}
+
+unsigned int MetaMethodConverters::generation()
+{
+    return metaMethodConvertersGeneration;
+}
+
+} // namespace PySide
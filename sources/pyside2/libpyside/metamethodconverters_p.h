@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef METAMETHODCONVERTERS_P_H
+#define METAMETHODCONVERTERS_P_H
+
+#include <sbkpython.h>
+#include <sbkconverter.h>
+
+#include <QByteArray>
+#include <QSharedPointer>
+
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+class QMetaMethod;
+class QMetaObject;
+QT_END_NAMESPACE
+
+namespace PySide
+{
+
+class MetaMethodConverters;
+typedef QSharedPointer<MetaMethodConverters> MetaMethodConvertersPtr;
+
+/**
+ * Converters for the return value and the parameters of a meta method,
+ * resolved from their type names once instead of on every call.
+ */
+class MetaMethodConverters
+{
+public:
+    explicit MetaMethodConverters(const QMetaMethod& method);
+
+    /// Returns the converters of \p method, resolving them on first use. They are cached only
+    /// when isCacheable() is true for the meta object of the method.
+    static MetaMethodConvertersPtr get(const QMetaMethod& method);
+    /// True for static meta objects and for registered PySide dynamic meta objects, whose
+    /// changes are reported by invalidate(). Others may be rebuilt or freed without notice.
+    static bool isCacheable(const QMetaObject* metaObject);
+    /// Lets the converters of the methods of a PySide dynamic meta object be cached.
+    static void registerDynamicMetaObject(const QMetaObject* metaObject);
+    /// Drops the cached converters of \p metaObject, which is being destroyed.
+    static void unregisterDynamicMetaObject(const QMetaObject* metaObject);
+    /// Drops the cached converters of the methods of \p metaObject, whose meta data changed.
+    static void invalidate(const QMetaObject* metaObject);
+    /// Counts the invalidations, for callers keeping converters to tell whether they were dropped.
+    static unsigned int generation();
+
+    /// True when the method returns a value.
+    bool hasReturnValue() const { return !m_types.front().typeName.isEmpty(); }
+    const QByteArray& returnType() const { return m_types.front().typeName; }
+    Shiboken::Conversions::SpecificConverter& returnConverter() { return m_types.front().resolveConverter(); }
+    /// Meta type id of the return value, 0 if it is not registered.
+    int returnMetaType() { return m_types.front().resolveMetaType(); }
+
+    int parameterCount() const { return int(m_types.size()) - 1; }
+    const QByteArray& parameterType(int index) const { return m_types[index + 1].typeName; }
+    Shiboken::Conversions::SpecificConverter& parameterConverter(int index) { return m_types[index + 1].resolveConverter(); }
+    /// Meta type id of a parameter, 0 if it is not registered.
+    int parameterMetaType(int index) { return m_types[index + 1].resolveMetaType(); }
+
+private:
+    struct TypeInfo
+    {
+        explicit TypeInfo(const QByteArray& name);
+        // Types may be registered after the first call, so failed lookups are retried.
+        Shiboken::Conversions::SpecificConverter& resolveConverter();
+        int resolveMetaType();
+
+        QByteArray typeName;
+        Shiboken::Conversions::SpecificConverter converter;
+        int metaType;
+    };
+
+    // The return type, followed by the parameter types.
+    std::vector<TypeInfo> m_types;
+};
+
+} // namespace PySide
+
+#endif
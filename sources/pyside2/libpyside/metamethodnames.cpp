@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "metamethodnames_p.h"
+
+#include <QMetaObject>
+
+namespace PySide
+{
+
+struct MetaMethodNamesRegistry
+{
+    QHash<const QMetaObject*, MetaMethodNames*> byMetaObject;
+    QHash<unsigned int, MetaMethodNames*> byLayout;
+};
+
+Q_GLOBAL_STATIC(MetaMethodNamesRegistry, metaMethodNames)
+
+// Layout 0 stands for wrappers without attribute slots.
+static unsigned int metaMethodNamesLayout = 0;
+
+MetaMethodNames::MetaMethodNames(const QMetaObject* metaObject)
+    : m_methodCount(metaObject->methodCount()),
+      m_layout(++metaMethodNamesLayout),
+      m_slotCount(0)
+{
+    m_entries.reserve(m_methodCount);
+    for (int i = 0; i < m_methodCount; ++i) {
+        const QMetaMethod method = metaObject->method(i);
+        const QByteArray name = method.name();
+        QHash<QByteArray, Entry>::iterator it = m_entries.find(name);
+        if (it == m_entries.end()) {
+            Entry entry;
+            entry.methodIndex = -1;
+            entry.slot = -1;
+            it = m_entries.insert(name, entry);
+        }
+        if (method.methodType() == QMetaMethod::Signal)
+            it->signalList.append(method);
+        else if (it->methodIndex == -1)
+            it->methodIndex = i;
+    }
+}
+
+const MetaMethodNames* MetaMethodNames::get(const QMetaObject* metaObject)
+{
+    MetaMethodNamesRegistry* registry = metaMethodNames();
+    MetaMethodNames*& names = registry->byMetaObject[metaObject];
+    // The methods of a dynamic base meta object may have changed as well.
+    if (names && names->m_methodCount != metaObject->methodCount()) {
+        registry->byLayout.remove(names->m_layout);
+        delete names;
+        names = 0;
+    }
+    if (!names) {
+        names = new MetaMethodNames(metaObject);
+        registry->byLayout.insert(names->m_layout, names);
+    }
+    return names;
+}
+
+const MetaMethodNames* MetaMethodNames::forLayout(unsigned int layout)
+{
+    return metaMethodNames()->byLayout.value(layout);
+}
+
+void MetaMethodNames::invalidate(const QMetaObject* metaObject)
+{
+    if (metaMethodNames.isDestroyed())
+        return;
+    MetaMethodNamesRegistry* registry = metaMethodNames();
+    MetaMethodNames* names = registry->byMetaObject.take(metaObject);
+    if (names) {
+        registry->byLayout.remove(names->m_layout);
+        delete names;
+    }
+}
+
+const MetaMethodNames::Entry* MetaMethodNames::find(const char* name) const
+{
+    QHash<QByteArray, Entry>::const_iterator it =
+        m_entries.constFind(QByteArray::fromRawData(name, int(qstrlen(name))));
+    return it != m_entries.constEnd() ? &it.value() : 0;
+}
+
+int MetaMethodNames::attributeSlot(const Entry& entry) const
+{
+    if (entry.slot < 0)
+        entry.slot = m_slotCount++;
+    return entry.slot;
+}
+
+} // namespace PySide
@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef METAMETHODNAMES_P_H
+#define METAMETHODNAMES_P_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QMetaMethod>
+
+QT_BEGIN_NAMESPACE
+class QMetaObject;
+QT_END_NAMESPACE
+
+namespace PySide
+{
+
+/**
+ * The methods of a meta object by name, for looking them up as attributes of QObjects
+ * without going through all methods. Attributes made from them are cached in numbered
+ * attribute slots of the wrappers, see Shiboken::Object::setAttributeSlot().
+ */
+class MetaMethodNames
+{
+public:
+    struct Entry
+    {
+        /// Index of the first method of the name that is not a signal, -1 if there is none.
+        int methodIndex;
+        /// The signals of the name.
+        QList<QMetaMethod> signalList;
+        /// Attribute slot of the name, -1 until an attribute is cached for it.
+        mutable int slot;
+    };
+
+    explicit MetaMethodNames(const QMetaObject* metaObject);
+
+    /// Returns the table of \p metaObject, building it on first use.
+    static const MetaMethodNames* get(const QMetaObject* metaObject);
+    /// Returns the table numbering attribute slots as \p layout, null if it was dropped.
+    static const MetaMethodNames* forLayout(unsigned int layout);
+    /// Drops the table of \p metaObject, whose meta data changed.
+    static void invalidate(const QMetaObject* metaObject);
+
+    /// Identifies the numbering of the attribute slots, unique among all tables built.
+    unsigned int layout() const { return m_layout; }
+    /// Returns the entry of \p name, or null when no method has that name.
+    const Entry* find(const char* name) const;
+    /// Returns the attribute slot of \p entry, assigning one on first use.
+    int attributeSlot(const Entry& entry) const;
+
+private:
+    int m_methodCount;
+    unsigned int m_layout;
+    mutable int m_slotCount;
+    QHash<QByteArray, Entry> m_entries;
+};
+
+} // namespace PySide
+
+#endif
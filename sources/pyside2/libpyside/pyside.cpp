@@ -47,6 +47,7 @@
 #include "pysideslot_p.h"
 #include "pysidemetafunction_p.h"
 #include "pysidemetafunction.h"
+#include "metamethodnames_p.h"
 #include "dynamicqmetaobject.h"
 #include "destroylistener.h"
 
@@ -249,10 +250,67 @@ void initQObjectSubType(SbkObjectType *type, PyObject *args, PyObject * /* kwds
     initDynamicMetaObject(type, baseMo, userData->cppObjSize);
 }
 
+// Returns the attribute cached as \p name in the attribute slots of \p self, borrowed, or null.
+static PyObject* cachedAttribute(SbkObject* self, PyObject* name)
+{
+#ifdef Py_LIMITED_API
+    Q_UNUSED(self);
+    Q_UNUSED(name);
+    return 0;
+#else
+    const unsigned int layout = Shiboken::Object::attributeSlotsLayout(self);
+    if (!layout)
+        return 0;
+    // Attributes assigned to the instance or its type since take precedence.
+    if (self->ob_dict && PyDict_GetItem(self->ob_dict, name))
+        return 0;
+    PyObject* typeAttr = _PyType_Lookup(Py_TYPE(self), name);
+    if (typeAttr && !PyObject_TypeCheck(typeAttr, PySideSignalTypeF()))
+        return 0;
+    const MetaMethodNames* names = MetaMethodNames::forLayout(layout);
+    const char* cname = Shiboken::String::toCString(name);
+    if (!names || !cname)
+        return 0;
+    const MetaMethodNames::Entry* entry = names->find(cname);
+    if (!entry || entry->slot < 0)
+        return 0;
+    return Shiboken::Object::getAttributeSlot(self, layout, entry->slot);
+#endif
+}
+
+// Caches \p attr as \p name in the attribute slots of \p self.
+// Returns false if the meta object has no method of that name to number the slot by,
+// or the slots cannot be looked up, see cachedAttribute().
+static bool cacheAttribute(SbkObject* self, const QMetaObject* metaObject, const char* name, PyObject* attr)
+{
+#ifdef Py_LIMITED_API
+    Q_UNUSED(self);
+    Q_UNUSED(metaObject);
+    Q_UNUSED(name);
+    Q_UNUSED(attr);
+    return false;
+#else
+    const MetaMethodNames* names = MetaMethodNames::get(metaObject);
+    const MetaMethodNames::Entry* entry = names->find(name);
+    if (!entry)
+        return false;
+    Shiboken::Object::setAttributeSlot(self, names->layout(), names->attributeSlot(*entry), attr);
+    return true;
+#endif
+}
+
 PyObject* getMetaDataFromQObject(QObject* cppSelf, PyObject* self, PyObject* name)
 {
+    SbkObject* sbkSelf = reinterpret_cast<SbkObject*>(self);
+    // Signal instances and meta functions are kept by the wrapper once made.
+    PyObject* cached = cachedAttribute(sbkSelf, name);
+    if (cached) {
+        Py_INCREF(cached);
+        return cached;
+    }
+
     PyObject* attr = PyObject_GenericGetAttr(self, name);
-    if (!Shiboken::Object::isValid(reinterpret_cast<SbkObject*>(self), false))
+    if (!Shiboken::Object::isValid(sbkSelf, false))
         return attr;
 
     if (attr && Property::checkType(attr)) {
@@ -267,41 +325,34 @@ PyObject* getMetaDataFromQObject(QObject* cppSelf, PyObject* self, PyObject* nam
     //mutate native signals to signal instance type
     if (attr && PyObject_TypeCheck(attr, PySideSignalTypeF())) {
         PyObject* signal = reinterpret_cast<PyObject*>(Signal::initialize(reinterpret_cast<PySideSignal*>(attr), name, self));
-        PyObject_SetAttr(self, name, reinterpret_cast<PyObject*>(signal));
+        const char* cname = Shiboken::String::toCString(name);
+        if (!cname || !cacheAttribute(sbkSelf, cppSelf->metaObject(), cname, signal))
+            PyObject_SetAttr(self, name, signal);
         return signal;
     }
 
     //search on metaobject (avoid internal attributes started with '__')
     if (!attr) {
         const char* cname = Shiboken::String::toCString(name);
-        uint cnameLen = qstrlen(cname);
         if (std::strncmp("__", cname, 2)) {
             const QMetaObject* metaObject = cppSelf->metaObject();
-            //signal
-            QList<QMetaMethod> signalList;
-            for(int i=0, i_max = metaObject->methodCount(); i < i_max; i++) {
-                QMetaMethod method = metaObject->method(i);
-                const QByteArray methSig_ = method.methodSignature();
-                const char *methSig = methSig_.constData();
-                bool methMacth = !std::strncmp(cname, methSig, cnameLen) && methSig[cnameLen] == '(';
-                if (methMacth) {
-                    if (method.methodType() == QMetaMethod::Signal) {
-                        signalList.append(method);
-                    } else {
-                        PySideMetaFunction* func = MetaFunction::newObject(cppSelf, i);
-                        if (func) {
-                            PyObject *result = reinterpret_cast<PyObject *>(func);
-                            PyObject_SetAttr(self, name, result);
-                            return result;
-                        }
-                    }
+            const MetaMethodNames::Entry* entry = MetaMethodNames::get(metaObject)->find(cname);
+            if (entry) {
+                // Copied, the table may be rebuilt while making the attribute.
+                const int methodIndex = entry->methodIndex;
+                const QList<QMetaMethod> signalList = entry->signalList;
+                PyObject* result = 0;
+                if (methodIndex != -1)
+                    result = reinterpret_cast<PyObject*>(MetaFunction::newObject(cppSelf, methodIndex));
+                else
+                    result = reinterpret_cast<PyObject*>(Signal::newObjectFromMethod(self, signalList));
+                if (result) {
+                    PyErr_Clear();
+                    if (!cacheAttribute(sbkSelf, metaObject, cname, result))
+                        PyObject_SetAttr(self, name, result);
+                    return result;
                 }
             }
-            if (signalList.size() > 0) {
-                PyObject* pySignal = reinterpret_cast<PyObject*>(Signal::newObjectFromMethod(self, signalList));
-                PyObject_SetAttr(self, name, pySignal);
-                return pySignal;
-            }
         }
     }
     return attr;
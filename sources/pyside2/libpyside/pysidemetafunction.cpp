@@ -39,10 +39,12 @@
 #include <sbkpython.h>
 #include "pysidemetafunction.h"
 #include "pysidemetafunction_p.h"
+#include "metamethodconverters_p.h"
 
 #include <shiboken.h>
 #include <QObject>
 #include <QMetaMethod>
+#include <QVarLengthArray>
 #include <QDebug>
 
 extern "C"
@@ -129,50 +131,50 @@ PySideMetaFunction* newObject(QObject* source, int methodIndex)
 
 bool call(QObject* self, int methodIndex, PyObject* args, PyObject** retVal)
 {
-
     QMetaMethod method = self->metaObject()->method(methodIndex);
-    QList<QByteArray> argTypes = method.parameterTypes();
+    return call(self, methodIndex, MetaMethodConverters::get(method), args, retVal);
+}
+
+bool call(QObject* self, int methodIndex, MetaMethodConvertersPtr converters, PyObject* args, PyObject** retVal)
+{
+    const int parameterCount = converters->parameterCount();
 
     // args given plus return type
     Shiboken::AutoDecRef sequence(PySequence_Fast(args, 0));
     int numArgs = PySequence_Fast_GET_SIZE(sequence.object()) + 1;
 
-    if (numArgs - 1 > argTypes.count()) {
+    if (numArgs - 1 > parameterCount) {
         PyErr_Format(PyExc_TypeError, "%s only accepts %d argument(s), %d given!",
-                     method.methodSignature().constData(),
-                     argTypes.count(), numArgs - 1);
+                     self->metaObject()->method(methodIndex).methodSignature().constData(),
+                     parameterCount, numArgs - 1);
         return false;
     }
 
-    if (numArgs - 1 < argTypes.count()) {
+    if (numArgs - 1 < parameterCount) {
         PyErr_Format(PyExc_TypeError, "%s needs %d argument(s), %d given!",
-                     method.methodSignature().constData(),
-                     argTypes.count(), numArgs - 1);
+                     self->metaObject()->method(methodIndex).methodSignature().constData(),
+                     parameterCount, numArgs - 1);
         return false;
     }
 
-    QVariant* methValues = new QVariant[numArgs];
-    void** methArgs = new void*[numArgs];
-
-    // Prepare room for return type
-    const char* returnType = method.typeName();
-    if (returnType && std::strcmp("void", returnType))
-        argTypes.prepend(returnType);
-    else
-        argTypes.prepend(QByteArray());
+    // Signals and slots rarely take more arguments than fit here, which spares the heap.
+    QVarLengthArray<QVariant, 8> methValues(numArgs);
+    QVarLengthArray<void*, 8> methArgs(numArgs);
 
+    // The return type comes first
     int i;
     for (i = 0; i < numArgs; ++i) {
-        const QByteArray& typeName = argTypes[i];
+        const QByteArray& typeName = i == 0 ? converters->returnType() : converters->parameterType(i - 1);
         // This must happen only when the method hasn't return type.
         if (typeName.isEmpty()) {
             methArgs[i] = 0;
             continue;
         }
 
-        Shiboken::Conversions::SpecificConverter converter(typeName);
+        Shiboken::Conversions::SpecificConverter& converter = i == 0
+            ? converters->returnConverter() : converters->parameterConverter(i - 1);
         if (converter) {
-            int typeId = QMetaType::type(typeName);
+            const int typeId = i == 0 ? converters->returnMetaType() : converters->parameterMetaType(i - 1);
             if (!Shiboken::Conversions::pythonTypeIsObjectType(converter)) {
                 if (!typeId) {
                     PyErr_Format(PyExc_TypeError, "Value types used on meta functions (including signals) need to be "
@@ -192,7 +194,7 @@ bool call(QObject* self, int methodIndex, PyObject* args, PyObject** retVal)
                 converter.toCpp(PySequence_Fast_GET_ITEM(sequence.object(), i - 1), methArgs[i]);
             }
         } else {
-            PyErr_Format(PyExc_TypeError, "Unknown type used to call meta function (that may be a signal): %s", argTypes[i].constData());
+            PyErr_Format(PyExc_TypeError, "Unknown type used to call meta function (that may be a signal): %s", typeName.constData());
             break;
         }
     }
@@ -200,7 +202,7 @@ bool call(QObject* self, int methodIndex, PyObject* args, PyObject** retVal)
     bool ok = i == numArgs;
     if (ok) {
         Py_BEGIN_ALLOW_THREADS
-        QMetaObject::metacall(self, QMetaObject::InvokeMetaMethod, method.methodIndex(), methArgs);
+        QMetaObject::metacall(self, QMetaObject::InvokeMetaMethod, methodIndex, methArgs.data());
         Py_END_ALLOW_THREADS
 
         if (retVal) {
@@ -215,9 +217,6 @@ bool call(QObject* self, int methodIndex, PyObject* args, PyObject** retVal)
         }
     }
 
-    delete[] methArgs;
-    delete[] methValues;
-
     return ok;
 }
 
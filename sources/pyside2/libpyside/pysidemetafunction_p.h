@@ -44,17 +44,24 @@
 #include <QList>
 #include <QByteArray>
 
+#include "metamethodconverters_p.h"
+
 QT_BEGIN_NAMESPACE
 class QObject;
 QT_END_NAMESPACE
 
-namespace PySide { namespace MetaFunction {
+namespace PySide {
+namespace MetaFunction {
 
     void init(PyObject* module);
     /**
      * Does a Qt metacall on a QObject
      */
     bool call(QObject* self, int methodIndex, PyObject* args, PyObject** retVal = 0);
+    /**
+     * Does a Qt metacall on a QObject, with the converters of the method already resolved
+     */
+    bool call(QObject* self, int methodIndex, MetaMethodConvertersPtr converters, PyObject* args, PyObject** retVal = 0);
 
 } //namespace MetaFunction
 } //namespace PySide
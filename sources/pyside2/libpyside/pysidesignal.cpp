@@ -41,6 +41,8 @@
 #include "pysidesignal.h"
 #include "pysidesignal_p.h"
 #include "signalmanager.h"
+#include "pysidemetafunction_p.h"
+#include "metamethodconverters_p.h"
 
 #include <shiboken.h>
 #include <QDebug>
@@ -301,6 +303,61 @@ void signalInstanceFree(void* self)
     Py_TYPE(pySelf)->tp_base->tp_free(self);
 }
 
+// Resolves the signal of \p data in the meta object of \p object, reusing the result of the
+// previous call unless the meta object or its converters changed since. Meta objects whose
+// changes PySide is not told about are resolved on every call.
+static bool resolveSignal(PySideSignalInstancePrivate* data, QObject* object)
+{
+    // Fetch the meta object first: updating a dynamic one invalidates its converters.
+    const QMetaObject* metaObject = object->metaObject();
+    const unsigned int generation = PySide::MetaMethodConverters::generation();
+    if (data->resolvedMetaObject != metaObject || data->convertersGeneration != generation
+        || !PySide::MetaMethodConverters::isCacheable(metaObject)) {
+        data->resolvedMetaObject = metaObject;
+        data->convertersGeneration = generation;
+        data->signalIndex = metaObject->indexOfSignal(data->signature);
+        data->converters = data->signalIndex != -1
+            ? PySide::MetaMethodConverters::get(metaObject->method(data->signalIndex))
+            : PySide::MetaMethodConvertersPtr();
+    }
+    return data->signalIndex != -1;
+}
+
+// Returns the QObject of the source of \p data with the signal resolved in it, letting emit,
+// connect and disconnect skip the source's Python methods and their signature parsing.
+// Returns null when the signal has to take the Python route, or when the source was deleted,
+// in which case \p deleted is set along with a Python error.
+static QObject* resolvedSource(PySideSignalInstancePrivate* data, bool* deleted)
+{
+    *deleted = false;
+    static PyTypeObject* qObjectType = Shiboken::Conversions::getPythonTypeObject("QObject*");
+    if (!qObjectType || !PyObject_TypeCheck(data->source, qObjectType))
+        return 0;
+
+    SbkObject* sbkSource = reinterpret_cast<SbkObject*>(data->source);
+    if (!Shiboken::Object::isValid(sbkSource, true)) {
+        *deleted = true;
+        return 0;
+    }
+    QObject* object = reinterpret_cast<QObject*>(Shiboken::Object::cppPointer(sbkSource, qObjectType));
+    if (!object || !resolveSignal(data, object))
+        return 0;
+    return object;
+}
+
+// Reads the optional connection type argument, returning false when it is not a Qt.ConnectionType.
+static bool readConnectionType(PyObject* type, Qt::ConnectionType* result)
+{
+    *result = Qt::AutoConnection;
+    if (!type)
+        return true;
+    static PyTypeObject* connectionTypeType = Shiboken::Conversions::getPythonTypeObject("Qt::ConnectionType");
+    if (!connectionTypeType || !PyObject_TypeCheck(type, connectionTypeType))
+        return false;
+    *result = static_cast<Qt::ConnectionType>(Shiboken::Enum::getValue(type));
+    return true;
+}
+
 PyObject* signalInstanceConnect(PyObject* self, PyObject* args, PyObject* kwds)
 {
     PyObject* slot = 0;
@@ -312,7 +369,9 @@ PyObject* signalInstanceConnect(PyObject* self, PyObject* args, PyObject* kwds)
         return 0;
 
     PySideSignalInstance* source = reinterpret_cast<PySideSignalInstance*>(self);
-    Shiboken::AutoDecRef pyArgs(PyList_New(0));
+    // The signal to connect and, when connecting to another signal, the target one.
+    PySideSignalInstance* connectSource = source;
+    PySideSignalInstance* connectTarget = 0;
 
     bool match = false;
     if (Py_TYPE(slot) == PySideSignalInstanceTypeF()) {
@@ -324,14 +383,8 @@ PyObject* signalInstanceConnect(PyObject* self, PyObject* args, PyObject* kwds)
             targetWalk = reinterpret_cast<PySideSignalInstance*>(slot);
             while (targetWalk && !match) {
                 if (QMetaObject::checkConnectArgs(sourceWalk->d->signature, targetWalk->d->signature)) {
-                    PyList_Append(pyArgs, sourceWalk->d->source);
-                    Shiboken::AutoDecRef sourceSignature(PySide::Signal::buildQtCompatible(sourceWalk->d->signature));
-                    PyList_Append(pyArgs, sourceSignature);
-
-                    PyList_Append(pyArgs, targetWalk->d->source);
-                    Shiboken::AutoDecRef targetSignature(PySide::Signal::buildQtCompatible(targetWalk->d->signature));
-                    PyList_Append(pyArgs, targetSignature);
-
+                    connectSource = sourceWalk;
+                    connectTarget = targetWalk;
                     match = true;
                 }
                 targetWalk = reinterpret_cast<PySideSignalInstance*>(targetWalk->d->next);
@@ -384,27 +437,54 @@ PyObject* signalInstanceConnect(PyObject* self, PyObject* args, PyObject* kwds)
             }
         }
 
-        // Adding references to pyArgs
-        PyList_Append(pyArgs, source->d->source);
-
-        if (matchedSlot) {
-            // If a slot matching the same number of arguments was found,
-            // include signature to the pyArgs
-            Shiboken::AutoDecRef signature(PySide::Signal::buildQtCompatible(it->d->signature));
-            PyList_Append(pyArgs, signature);
-        } else {
-            // Try the first by default if the slot was not found
-            Shiboken::AutoDecRef signature(PySide::Signal::buildQtCompatible(source->d->signature));
-            PyList_Append(pyArgs, signature);
-        }
-        PyList_Append(pyArgs, slot);
+        // If a slot matching the same number of arguments was found use its signature,
+        // otherwise try the first by default.
+        if (matchedSlot)
+            connectSource = it;
         match = true;
     }
 
-    if (type)
-        PyList_Append(pyArgs, type);
+    Qt::ConnectionType connectionType;
+    if (match && readConnectionType(type, &connectionType)) {
+        // Connect straight through the meta object system when both ends resolve.
+        bool deleted;
+        QObject* sourceObject = resolvedSource(connectSource->d, &deleted);
+        if (deleted)
+            return 0;
+        if (sourceObject && connectTarget) {
+            QObject* targetObject = resolvedSource(connectTarget->d, &deleted);
+            if (deleted)
+                return 0;
+            if (targetObject) {
+                bool connection;
+                Py_BEGIN_ALLOW_THREADS
+                connection = QMetaObject::connect(sourceObject, connectSource->d->signalIndex,
+                                                  targetObject, connectTarget->d->signalIndex, connectionType);
+                Py_END_ALLOW_THREADS
+                return PyBool_FromLong(connection);
+            }
+        } else if (sourceObject && PyCallable_Check(slot)) {
+            PySide::SignalManager& signalManager = PySide::SignalManager::instance();
+            return PyBool_FromLong(signalManager.connectCallback(sourceObject, connectSource->d->signalIndex,
+                                                                 slot, connectionType));
+        }
+    }
 
     if (match) {
+        Shiboken::AutoDecRef pyArgs(PyList_New(0));
+        PyList_Append(pyArgs, connectSource->d->source);
+        Shiboken::AutoDecRef sourceSignature(PySide::Signal::buildQtCompatible(connectSource->d->signature));
+        PyList_Append(pyArgs, sourceSignature);
+        if (connectTarget) {
+            PyList_Append(pyArgs, connectTarget->d->source);
+            Shiboken::AutoDecRef targetSignature(PySide::Signal::buildQtCompatible(connectTarget->d->signature));
+            PyList_Append(pyArgs, targetSignature);
+        } else {
+            PyList_Append(pyArgs, slot);
+        }
+        if (type)
+            PyList_Append(pyArgs, type);
+
         Shiboken::AutoDecRef tupleArgs(PyList_AsTuple(pyArgs));
         Shiboken::AutoDecRef pyMethod(PyObject_GetAttrString(source->d->source, "connect"));
         if (pyMethod.isNull()) { // PYSIDE-79: check if pyMethod exists.
@@ -431,7 +511,6 @@ PyObject* signalInstanceEmit(PyObject* self, PyObject* args)
 {
     PySideSignalInstance* source = reinterpret_cast<PySideSignalInstance*>(self);
 
-    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     int numArgsGiven = PySequence_Fast_GET_SIZE(args);
     int numArgsInSignature = argCountInSignature(source->d->signature);
 
@@ -453,6 +532,17 @@ PyObject* signalInstanceEmit(PyObject* self, PyObject* args)
             }
         }
     }
+
+    bool deleted;
+    if (QObject* object = resolvedSource(source->d, &deleted)) {
+        if (!PySide::MetaFunction::call(object, source->d->signalIndex, source->d->converters, args))
+            return 0;
+        Py_RETURN_TRUE;
+    }
+    if (deleted)
+        return 0;
+
+    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     Shiboken::AutoDecRef sourceSignature(PySide::Signal::buildQtCompatible(source->d->signature));
 
     PyList_Append(pyArgs, sourceSignature);
@@ -491,7 +581,6 @@ PyObject* signalInstanceGetItem(PyObject* self, PyObject* key)
 PyObject* signalInstanceDisconnect(PyObject* self, PyObject* args)
 {
     PySideSignalInstance* source = reinterpret_cast<PySideSignalInstance*>(self);
-    Shiboken::AutoDecRef pyArgs(PyList_New(0));
 
     PyObject* slot;
     if (PyTuple_Check(args) && PyTuple_GET_SIZE(args))
@@ -499,6 +588,42 @@ PyObject* signalInstanceDisconnect(PyObject* self, PyObject* args)
     else
         slot = Py_None;
 
+    // Disconnect straight through the meta object system when both ends resolve.
+    bool deleted;
+    QObject* sourceObject = resolvedSource(source->d, &deleted);
+    if (deleted)
+        return 0;
+    if (sourceObject) {
+        bool disconnected = false;
+        bool resolved = false;
+        if (Py_TYPE(slot) == PySideSignalInstanceTypeF()) {
+            PySideSignalInstance* target = reinterpret_cast<PySideSignalInstance*>(slot);
+            if (QMetaObject::checkConnectArgs(source->d->signature, target->d->signature)) {
+                QObject* targetObject = resolvedSource(target->d, &deleted);
+                if (deleted)
+                    return 0;
+                if (targetObject) {
+                    Py_BEGIN_ALLOW_THREADS
+                    disconnected = QMetaObject::disconnect(sourceObject, source->d->signalIndex,
+                                                           targetObject, target->d->signalIndex);
+                    Py_END_ALLOW_THREADS
+                    resolved = true;
+                }
+            }
+        } else if (slot != Py_None && PyCallable_Check(slot)) {
+            PySide::SignalManager& signalManager = PySide::SignalManager::instance();
+            disconnected = signalManager.disconnectCallback(sourceObject, source->d->signalIndex, slot);
+            resolved = true;
+        }
+        if (disconnected)
+            Py_RETURN_TRUE;
+        if (resolved) {
+            PyErr_Format(PyExc_RuntimeError, "Failed to disconnect signal %s.", source->d->signature);
+            return 0;
+        }
+    }
+
+    Shiboken::AutoDecRef pyArgs(PyList_New(0));
     bool match = false;
     if (Py_TYPE(slot) == PySideSignalInstanceTypeF()) {
         PySideSignalInstance* target = reinterpret_cast<PySideSignalInstance*>(slot);
@@ -747,6 +872,10 @@ void instanceInitialize(PySideSignalInstance* self, PyObject* name, PySideSignal
     selfPvt->signature = buildSignature(self->d->signalName, data->signatures[index]);
     selfPvt->attributes = data->signatureAttributes[index];
     selfPvt->homonymousMethod = 0;
+    selfPvt->resolvedMetaObject = 0;
+    selfPvt->signalIndex = -1;
+    selfPvt->converters.reset();
+    selfPvt->convertersGeneration = 0;
     if (data->homonymousMethod) {
         selfPvt->homonymousMethod = data->homonymousMethod;
         Py_INCREF(selfPvt->homonymousMethod);
@@ -799,6 +928,10 @@ PySideSignalInstance* newObjectFromMethod(PyObject* source, const QList<QMetaMet
         selfPvt->signature = strdup(m.methodSignature());
         selfPvt->attributes = m.attributes();
         selfPvt->homonymousMethod = 0;
+        selfPvt->resolvedMetaObject = 0;
+        selfPvt->signalIndex = -1;
+        selfPvt->converters.reset();
+        selfPvt->convertersGeneration = 0;
         selfPvt->next = 0;
     }
     return root;
@@ -42,6 +42,14 @@
 
 #include <sbkpython.h>
 
+#include <QtCore/qglobal.h>
+
+#include "metamethodconverters_p.h"
+
+QT_BEGIN_NAMESPACE
+struct QMetaObject;
+QT_END_NAMESPACE
+
 extern "C"
 {
     extern PyTypeObject *PySideSignalTypeF(void);
@@ -64,6 +72,13 @@ extern "C"
         PyObject* source;
         PyObject* homonymousMethod;
         PySideSignalInstance* next;
+        /// Meta object of the source the signal data below was resolved in, null until first needed.
+        const QMetaObject* resolvedMetaObject;
+        /// Method index of the signal in resolvedMetaObject, -1 if it has none.
+        int signalIndex;
+        /// Converters of the signal arguments, valid while the converter generation is convertersGeneration.
+        PySide::MetaMethodConvertersPtr converters;
+        unsigned int convertersGeneration;
     };
 
 
@@ -77,6 +77,11 @@ public:
     void notifyGlobalReceiver(QObject* receiver);
 
     bool emitSignal(QObject* source, const char* signal, PyObject* args);
+
+    // Connects the signal at \p signalIndex of \p source to a Python callable.
+    bool connectCallback(QObject* source, int signalIndex, PyObject* callback, Qt::ConnectionType type);
+    // Undoes a connection made by connectCallback().
+    bool disconnectCallback(QObject* source, int signalIndex, PyObject* callback);
     static int qt_metacall(QObject* object, QMetaObject::Call call, int id, void** args);
 
     // Used to register a new signal/slot on QMetaobject of source.
@@ -31,6 +31,8 @@
 
 '''Tests QByteArray implementation of Python buffer protocol'''
 
+import hashlib
+import struct
 import unittest
 import py3kcompat as py3k
 
@@ -48,6 +50,47 @@ class QByteArrayBufferProtocolTest(unittest.TestCase):
         #function which an unicode object or other object implementing the Python buffer protocol
         isdir(QByteArray('/tmp'))
 
+    def testMemoryView(self):
+        if not py3k.IS_PY3K:
+            return
+        ba = QByteArray(py3k.b('hello world'))
+        view = memoryview(ba)
+        self.assertEqual(view.nbytes, ba.size())
+        self.assertEqual(view.tobytes(), ba.data())
+        self.assertEqual(hashlib.md5(ba).digest(), hashlib.md5(ba.data()).digest())
+
+    def testViewIsReadOnly(self):
+        if not py3k.IS_PY3K:
+            return
+        ba = QByteArray(py3k.b('hello'))
+        copy = QByteArray(ba)
+        for view in (memoryview(ba), ba.toMemoryView()):
+            self.assertTrue(view.readonly)
+            self.assertRaises(TypeError, view.__setitem__, 0, ord('j'))
+        self.assertEqual(copy, py3k.b('hello'))
+
+    def testWriteThroughBuffer(self):
+        if not py3k.IS_PY3K:
+            return
+        ba = QByteArray(py3k.b('hello'))
+        copy = QByteArray(ba)
+        # Writing detaches the array from its copies.
+        struct.pack_into('c', ba, 0, py3k.b('j'))
+        self.assertEqual(ba, py3k.b('jello'))
+        self.assertEqual(copy, py3k.b('hello'))
+        struct.pack_into('c', copy, 4, py3k.b('!'))
+        self.assertEqual(ba, py3k.b('jello'))
+        self.assertEqual(copy, py3k.b('hell!'))
+
+    def testViewOutlivesResize(self):
+        if not py3k.IS_PY3K:
+            return
+        ba = QByteArray(py3k.b('abc'))
+        view = memoryview(ba)
+        ba.resize(1024 * 1024)
+        del ba
+        self.assertEqual(view.tobytes(), py3k.b('abc'))
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -0,0 +1,82 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+#############################################################################
+##
+## Copyright (C) 2018 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for QIODevice.readinto() and QIODevice.peekinto()'''
+
+import unittest
+
+from PySide2.QtCore import QBuffer, QByteArray, QIODevice
+import py3kcompat as py3k
+
+class ChunkedBuffer(QBuffer):
+    '''Device whose readData() returns a bytearray containing NUL bytes.'''
+    def readData(self, maxlen):
+        return bytearray(py3k.b('\x00\x01\x02\x03'))[:maxlen]
+
+class QIODeviceReadIntoTest(unittest.TestCase):
+
+    def setUp(self):
+        self.buffer = QBuffer()
+        self.buffer.setData(QByteArray(py3k.b('binary\x00data')))
+        self.assertTrue(self.buffer.open(QIODevice.ReadOnly))
+
+    def tearDown(self):
+        self.buffer.close()
+
+    def testReadInto(self):
+        target = bytearray(6)
+        self.assertEqual(self.buffer.readinto(target), 6)
+        self.assertEqual(bytes(target), py3k.b('binary'))
+        target = bytearray(16)
+        self.assertEqual(self.buffer.readinto(memoryview(target)[2:]), 5)
+        self.assertEqual(bytes(target[2:7]), py3k.b('\x00data'))
+        self.assertEqual(self.buffer.readinto(target), 0)
+
+    def testPeekInto(self):
+        target = bytearray(6)
+        self.assertEqual(self.buffer.peekinto(target), 6)
+        self.assertEqual(self.buffer.pos(), 0)
+        self.assertEqual(self.buffer.read(6), py3k.b('binary'))
+
+    def testReadOnlyTarget(self):
+        self.assertRaises((TypeError, BufferError), self.buffer.readinto, py3k.b('immutable'))
+
+    def testBaseReadDataKeepsNul(self):
+        data = QBuffer.readData(self.buffer, 11)
+        self.assertEqual(data, py3k.b('binary\x00data'))
+
+    def testReadDataOverrideReturningBuffer(self):
+        device = ChunkedBuffer()
+        self.assertTrue(device.open(QIODevice.ReadOnly))
+        self.assertEqual(device.read(2), py3k.b('\x00\x01'))
+
+if __name__ == '__main__':
+    unittest.main()
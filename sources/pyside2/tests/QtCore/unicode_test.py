@@ -58,6 +58,15 @@ class UnicodeConversion(unittest.TestCase):
         obj.setObjectName(py3k.unicode_('ümlaut'))
         self.assertEqual(obj.objectName(), py3k.unicode_('ümlaut'))
 
+    def testRoundTripAllStringKinds(self):
+        #ASCII, Latin-1, BMP and astral strings, with embedded and leading special characters
+        strings = [u'', u'ascii', u'\xfcmlaut', u'\u0393\u03b5\u03b9\u03ac', u'\ufeffbom',
+                   u'nul\x00inside', u'\U0001f632 emoji', u'mixed \xe9 \u20ac \U0001f600']
+        obj = QObject()
+        for s in strings:
+            obj.setObjectName(s)
+            self.assertEqual(obj.objectName(), s)
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -0,0 +1,124 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+#############################################################################
+##
+## Copyright (C) 2018 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for constructing QImages on Python buffers and exporting their pixels'''
+
+import gc
+import struct
+import unittest
+import py3kcompat as py3k
+
+from PySide2.QtGui import QColor, QImage
+
+hasNumPy = False
+
+try:
+    import numpy
+    hasNumPy = True
+except ImportError:
+    pass
+
+class QImageBufferTest(unittest.TestCase):
+    '''Test case for the buffer protocol of QImage'''
+
+    def testImageKeepsBufferAlive(self):
+        data = bytearray(b'\x10\x20\x30\xff' * 6)
+        image = QImage(data, 3, 2, QImage.Format_ARGB32)
+        # The image locks the memory of the bytearray
+        self.assertRaises(BufferError, data.extend, b'\0')
+        data[0] = 0x40
+        self.assertEqual(QColor(image.pixel(0, 0)).blue(), 0x40)
+        del data
+        gc.collect()
+        self.assertEqual(QColor(image.pixel(2, 1)).green(), 0x20)
+
+    def testImageCopyKeepsBufferAlive(self):
+        data = bytearray(b'\x10\x20\x30\xff' * 4)
+        copy = QImage(QImage(data, 2, 2, 8, QImage.Format_ARGB32))
+        del data
+        gc.collect()
+        self.assertEqual(QColor(copy.pixel(1, 1)).red(), 0x30)
+
+    def testReadOnlyBufferIsCopiedOnWrite(self):
+        data = py3k.b('\x10\x20\x30\xff' * 4)
+        image = QImage(data, 2, 2, QImage.Format_ARGB32)
+        image.setPixel(0, 0, 0xff000000)
+        self.assertEqual(data, py3k.b('\x10\x20\x30\xff' * 4))
+        self.assertEqual(image.pixel(0, 0), 0xff000000)
+
+    def testBufferTooSmall(self):
+        image = QImage(bytearray(10), 10, 10, QImage.Format_ARGB32)
+        self.assertTrue(image.isNull())
+
+    @unittest.skipUnless(py3k.IS_PY3K, 'The buffer protocol of QImage requires Python 3')
+    def testExportShape(self):
+        image = QImage(3, 2, QImage.Format_RGB888)
+        image.fill(0)
+        view = memoryview(image)
+        self.assertEqual(view.shape, (2, 3, 3))
+        self.assertEqual(view.strides, (image.bytesPerLine(), 3, 1))
+        gray = memoryview(QImage(5, 4, QImage.Format_Grayscale8))
+        self.assertEqual(gray.shape, (4, 5))
+
+    @unittest.skipUnless(py3k.IS_PY3K, 'The buffer protocol of QImage requires Python 3')
+    def testExportIsReadOnly(self):
+        image = QImage(2, 2, QImage.Format_ARGB32)
+        image.fill(0)
+        copy = QImage(image)
+        view = memoryview(image)
+        self.assertTrue(view.readonly)
+        self.assertRaises(TypeError, view.__setitem__, (0, 0, 0), 1)
+        del view
+        # Requesting write access detaches the image from its copies.
+        struct.pack_into('I', image, 0, 0xff102030)
+        self.assertEqual(image.pixel(0, 0), 0xff102030)
+        self.assertEqual(copy.pixel(0, 0), 0)
+
+    @unittest.skipUnless(py3k.IS_PY3K, 'The buffer protocol of QImage requires Python 3')
+    def testReadOnlyDataIsNotExportedForWriting(self):
+        data = py3k.b('\x10\x20\x30\xff' * 4)
+        image = QImage(data, 2, 2, QImage.Format_ARGB32)
+        self.assertRaises((TypeError, BufferError), struct.pack_into, 'I', image, 0, 0)
+        self.assertEqual(data, py3k.b('\x10\x20\x30\xff' * 4))
+        self.assertEqual(memoryview(image).tobytes(), data)
+
+    @unittest.skipUnless(py3k.IS_PY3K and hasNumPy, 'Requires Python 3 and numpy')
+    def testNumPyRoundTrip(self):
+        frame = numpy.zeros((4, 6, 4), dtype = numpy.uint8)
+        frame[1, 2] = (0x30, 0x20, 0x10, 0xff)
+        image = QImage(frame, 6, 4, QImage.Format_ARGB32)
+        self.assertEqual(QColor(image.pixel(2, 1)), QColor(0x10, 0x20, 0x30))
+        pixels = numpy.asarray(image)
+        self.assertEqual(pixels.shape, (4, 6, 4))
+        self.assertEqual(pixels[1, 2].tolist(), [0x30, 0x20, 0x10, 0xff])
+
+if __name__ == '__main__':
+    unittest.main()
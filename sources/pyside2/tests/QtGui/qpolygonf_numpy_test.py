@@ -0,0 +1,127 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+#############################################################################
+##
+## Copyright (C) 2018 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for passing numpy arrays as QPolygonF, QVector<QPointF>, QVector<QLineF> and QVector<QRectF>'''
+
+import unittest
+import py3kcompat as py3k
+
+from PySide2.QtCore import QLineF, QPointF, QRectF, Qt
+from PySide2.QtGui import QColor, QImage, QPainter, QPainterPath, QPolygonF
+
+hasNumPy = False
+
+try:
+    import numpy
+    hasNumPy = True
+except ImportError:
+    pass
+
+class QPolygonFNumPyTest(unittest.TestCase):
+    '''Test case for converting numpy arrays to and from QPolygonF'''
+
+    def testPolygonFromArray(self):
+        points = numpy.array([[0, 0], [10, 0], [10, 5]], dtype = 'float64')
+        polygon = QPolygonF(points)
+        self.assertEqual(len(polygon), 3)
+        self.assertEqual(polygon[1], QPointF(10, 0))
+        self.assertEqual(polygon[2], QPointF(10, 5))
+
+    def testPolygonFromStridedAndFloat32Array(self):
+        points = numpy.arange(12, dtype = 'float32').reshape(6, 2)[::2]
+        polygon = QPolygonF(points)
+        self.assertEqual(len(polygon), 3)
+        self.assertEqual(polygon[1], QPointF(4, 5))
+        columns = numpy.arange(12, dtype = 'float64').reshape(3, 4)[:, 1:3]
+        polygon = QPolygonF(columns)
+        self.assertEqual(polygon[2], QPointF(9, 10))
+
+    def testEmptyArray(self):
+        self.assertEqual(len(QPolygonF(numpy.zeros((0, 2)))), 0)
+
+    def testWrongShape(self):
+        self.assertRaises(TypeError, QPolygonF, numpy.zeros((3, 3)))
+        self.assertRaises(TypeError, QPolygonF, numpy.zeros(6))
+
+    def testPainterPath(self):
+        path = QPainterPath()
+        path.addPolygon(numpy.array([[1, 2], [5, 2], [5, 8]], dtype = 'float64'))
+        self.assertEqual(path.boundingRect(), QRectF(1, 2, 4, 6))
+
+    @unittest.skipUnless(py3k.IS_PY3K, 'The buffer protocol of QPolygonF requires Python 3')
+    def testPolygonToArray(self):
+        polygon = QPolygonF([QPointF(1, 2), QPointF(3, 4), QPointF(5, 6)])
+        points = numpy.asarray(polygon)
+        self.assertEqual(points.shape, (3, 2))
+        self.assertEqual(points.dtype, numpy.float64)
+        self.assertEqual(points.tolist(), [[1, 2], [3, 4], [5, 6]])
+        # The array holds on to the points when the polygon changes
+        polygon.clear()
+        self.assertEqual(points[2, 1], 6)
+        self.assertEqual(QPolygonF(points)[1], QPointF(3, 4))
+
+class QPainterNumPyTest(unittest.TestCase):
+    '''Test case for drawing numpy arrays of coordinates with QPainter'''
+
+    def setUp(self):
+        self.image = QImage(20, 20, QImage.Format_ARGB32)
+        self.image.fill(Qt.white)
+        self.painter = QPainter(self.image)
+        self.painter.setPen(Qt.black)
+
+    def tearDown(self):
+        if self.painter.isActive():
+            self.painter.end()
+        del self.painter
+        del self.image
+
+    def isBlack(self, x, y):
+        self.painter.end()
+        return QColor(self.image.pixel(x, y)) == QColor(Qt.black)
+
+    def testDrawPolyline(self):
+        self.painter.drawPolyline(numpy.array([[2, 2], [2, 17], [17, 17]], dtype = 'float64'))
+        self.assertTrue(self.isBlack(2, 10))
+
+    def testDrawPoints(self):
+        self.painter.drawPoints(numpy.array([[3, 4], [15, 16]], dtype = 'float64'))
+        self.assertTrue(self.isBlack(15, 16))
+
+    def testDrawLines(self):
+        self.painter.drawLines(numpy.array([[0, 5, 19, 5], [0, 12, 19, 12]], dtype = 'float64'))
+        self.assertTrue(self.isBlack(10, 12))
+
+    def testDrawRects(self):
+        self.painter.drawRects(numpy.array([[4, 4, 10, 10]], dtype = 'float64'))
+        self.assertTrue(self.isBlack(4, 9))
+
+if __name__ == '__main__' and hasNumPy:
+    unittest.main()
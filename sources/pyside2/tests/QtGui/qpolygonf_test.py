@@ -26,6 +26,8 @@
 ##
 #############################################################################
 
+import struct
+import sys
 import unittest
 from PySide2.QtCore import *
 from PySide2.QtGui import *
@@ -51,5 +53,18 @@ class QPolygonFNotIterableTest(unittest.TestCase):
         p << QPoint(10, 20) << QPoint(20, 30) << [QPoint(20, 30), QPoint(40, 50)]
         self.assertEqual(len(p), 4)
 
+    @unittest.skipUnless(sys.version_info[0] >= 3, 'The buffer protocol of QPolygonF requires Python 3')
+    def testBufferDoesNotWriteToCopies(self):
+        poly = QPolygonF([QPointF(1, 2), QPointF(3, 4)])
+        poly2 = QPolygonF(poly)
+        view = memoryview(poly)
+        self.assertTrue(view.readonly)
+        self.assertRaises(TypeError, view.__setitem__, 0, 0)
+        del view
+        # Requesting write access detaches the polygon from its copies.
+        struct.pack_into('d', poly, 0, 7.0)
+        self.assertEqual(poly[0], QPointF(7, 2))
+        self.assertEqual(poly2[0], QPointF(1, 2))
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,56 @@
+#############################################################################
+##
+## Copyright (C) 2018 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for passing numpy arrays to QList<QRectF> arguments'''
+
+import unittest
+
+from PySide2.QtCore import QRectF
+from PySide2.QtWidgets import QGraphicsScene, QGraphicsView
+
+from helper import UsesQApplication
+
+hasNumPy = False
+
+try:
+    import numpy
+    hasNumPy = True
+except ImportError:
+    pass
+
+class QGraphicsViewNumPyTest(UsesQApplication):
+    '''Only contiguous containers like QVector<QRectF> can be filled from numpy arrays'''
+
+    def testListFromArrayIsRejected(self):
+        view = QGraphicsView(QGraphicsScene())
+        rects = numpy.array([[0, 0, 10, 10], [5, 5, 10, 10]], dtype = 'float64')
+        self.assertRaises(TypeError, view.updateScene, rects)
+        view.updateScene([QRectF(0, 0, 10, 10), QRectF(5, 5, 10, 10)])
+
+if __name__ == '__main__' and hasNumPy:
+    unittest.main()
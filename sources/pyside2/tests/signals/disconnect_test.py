@@ -83,6 +83,40 @@ class TestDisconnect(unittest.TestCase):
         obj.signalWithDefaultValue.emit()
         self.assertTrue(self.called)
 
+    def testSignalToSignal(self):
+        self.called1 = False
+        source = Foo()
+        target = Foo()
+        source.bar.connect(target.bar)
+        target.bar.connect(self.theSlot1)
+        source.bar.emit()
+        self.assertTrue(self.called1)
+
+        self.called1 = False
+        source.bar.disconnect(target.bar)
+        source.bar.emit()
+        self.assertFalse(self.called1)
+
+    def testConnectionType(self):
+        self.called1 = False
+        f = Foo()
+        self.assertTrue(f.bar.connect(self.theSlot1, Qt.DirectConnection))
+        f.bar.emit()
+        self.assertTrue(self.called1)
+        self.assertRaises(TypeError, f.bar.connect, self.theSlot2, 'direct')
+
+    def testDisconnectCallback(self):
+        self.called1 = False
+        self.called2 = False
+        f = Foo()
+        f.bar.connect(self.theSlot1)
+        f.bar.connect(self.theSlot2)
+        f.bar.disconnect(self.theSlot1)
+        f.bar.emit()
+        self.assertFalse(self.called1)
+        self.assertTrue(self.called2)
+        self.assertRaises(RuntimeError, f.bar.disconnect, self.theSlot1)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -30,7 +30,7 @@ import sys
 import unittest
 from functools import partial
 
-from PySide2.QtCore import QObject, SIGNAL, QProcess
+from PySide2.QtCore import QObject, SIGNAL, QProcess, Signal
 
 from helper import BasicPySlotCase, UsesQCoreApplication
 
@@ -99,5 +99,48 @@ class QProcessMultipleSlots(UsesQCoreApplication, MultipleSignalConnections):
 
         self.run_many(sender, 'finished(int)', start_proc, receivers, (0,))
 
+class EqualCallable(object):
+    '''Callables comparing equal to each other, which still are distinct receivers'''
+    def __init__(self, calls):
+        self.calls = calls
+
+    def __call__(self):
+        self.calls.append(self)
+
+    def __eq__(self, other):
+        return True
+
+    def __hash__(self):
+        return 0
+
+class Emitter(QObject):
+    sig = Signal()
+    valueChanged = Signal(int)
+
+class EqualCallbackConnections(unittest.TestCase):
+    '''Connections to callables that compare equal'''
+
+    def testEqualCallables(self):
+        calls = []
+        first = EqualCallable(calls)
+        second = EqualCallable(calls)
+        obj = Emitter()
+        obj.sig.connect(first)
+        obj.sig.connect(second)
+        obj.sig.emit()
+        self.assertEqual(len(calls), 2)
+        self.assertTrue(calls[0] is not calls[1])
+
+    def testBuiltinMethod(self):
+        # A builtin bound method is a new object on every attribute access
+        values = []
+        obj = Emitter()
+        obj.valueChanged.connect(values.append)
+        obj.valueChanged.emit(1)
+        obj.valueChanged.disconnect(values.append)
+        obj.valueChanged.emit(2)
+        self.assertEqual(values, [1])
+        self.assertEqual(obj.receivers(SIGNAL('valueChanged(int)')), 0)
+
 if __name__ == '__main__':
     unittest.main()
@@ -71,6 +71,16 @@ class TestQObjectReceivers(unittest.TestCase):
         self.assertEqual(sender.receivers(SIGNAL("some_dynamic_signal(  )")), 1)
         sender.connect(sender, SIGNAL("some_dynamic_signal()"), receiver, SLOT("deleteLater()"))
         self.assertEqual(sender.receivers(SIGNAL("some_dynamic_signal(  )")), 2)
+    def testSharedCallback(self):
+        '''A callback connected to many senders is counted once per sender'''
+        senders = [QObject() for i in range(10)]
+        for sender in senders:
+            sender.destroyed.connect(cute_slot)
+        for sender in senders:
+            self.assertEqual(sender.receivers(SIGNAL("destroyed()")), 1)
+        senders[0].destroyed.disconnect(cute_slot)
+        self.assertEqual(senders[0].receivers(SIGNAL("destroyed()")), 0)
+        self.assertEqual(senders[1].receivers(SIGNAL("destroyed()")), 1)
 
 if __name__ == '__main__':
     unittest.main()
@@ -34,7 +34,15 @@ import sys
 import unittest
 import functools
 
-from PySide2.QtCore import QObject, SIGNAL, SLOT, QProcess, QTimeLine
+from PySide2.QtCore import QObject, SIGNAL, SLOT, QProcess, QTimeLine, Signal, QAbstractListModel
+try:
+    # The normal import statement when PySide2 is installed.
+    from PySide2 import shiboken2 as shiboken
+except ImportError:
+    # When running make test in shiboken build dir, or when running
+    # testrunner.py, shiboken2 is not part of the PySide2 module,
+    # so it needs to be imported as a standalone module.
+    import shiboken2 as shiboken
 
 from helper import BasicPySlotCase, UsesQCoreApplication
 
@@ -148,5 +156,47 @@ class EmitEnum(UsesQCoreApplication):
         p.stateChanged.emit(QProcess.NotRunning)
         self.assertEqual(self.arg, QProcess.NotRunning)
 
+class Emitter(QObject):
+    valueChanged = Signal(int, str)
+
+class ListModel(QAbstractListModel):
+    def rowCount(self, parent=None):
+        return 1
+
+class SignalInstanceEmission(UsesQCoreApplication):
+    """Test emission through signal instances, which skips QObject.emit()"""
+
+    def slot(self, *args):
+        self.received.append(args)
+
+    def testRepeatedEmission(self):
+        self.received = []
+        obj = Emitter()
+        obj.valueChanged.connect(self.slot)
+        for i in range(100):
+            self.assertTrue(obj.valueChanged.emit(i, str(i)))
+        self.assertEqual(self.received, [(i, str(i)) for i in range(100)])
+
+    def testWrongArgumentCount(self):
+        obj = Emitter()
+        self.assertRaises(TypeError, obj.valueChanged.emit, 1)
+        self.assertRaises(TypeError, obj.valueChanged.emit, 1, 'one', 2)
+
+    def testDefaultArguments(self):
+        """dataChanged() has a default roles argument, emitting without it picks the cloned signal"""
+        self.received = []
+        model = ListModel()
+        model.dataChanged.connect(self.slot)
+        index = model.index(0, 0)
+        model.dataChanged.emit(index, index)
+        self.assertEqual(len(self.received), 1)
+        self.assertEqual(self.received[0][0], index)
+
+    def testDeletedSource(self):
+        obj = Emitter()
+        signal = obj.valueChanged
+        shiboken.delete(obj)
+        self.assertRaises(RuntimeError, signal.emit, 1, 'one')
+
 if __name__ == '__main__':
     unittest.main()
@@ -86,5 +86,35 @@ class SignalNumberLimitTest(unittest.TestCase):
         e.s14.emit()
         self.assertEqual(self._count, 14)
 
+class DynamicSignalNumberTest(unittest.TestCase):
+    '''Many signals added to one object's dynamic meta object, one update at a time.'''
+
+    def emitAll(self, obj, count):
+        for i in range(count):
+            obj.emit(QtCore.SIGNAL('sig%d(int)' % i), i)
+
+    def testManyDynamicSignals(self):
+        count = 200
+        received = []
+        obj = QtCore.QObject()
+        callbacks = [lambda value, i=i: received.append((i, value)) for i in range(count)]
+        for i in range(count):
+            obj.connect(QtCore.SIGNAL('sig%d(int)' % i), callbacks[i])
+        self.emitAll(obj, count)
+        self.assertEqual(received, [(i, i) for i in range(count)])
+
+        # Removing and adding again goes through the methods left blank.
+        for i in range(0, count, 2):
+            obj.disconnect(QtCore.SIGNAL('sig%d(int)' % i), callbacks[i])
+        del received[:]
+        self.emitAll(obj, count)
+        self.assertEqual(received, [(i, i) for i in range(1, count, 2)])
+
+        for i in range(0, count, 2):
+            obj.connect(QtCore.SIGNAL('sig%d(int)' % i), callbacks[i])
+        del received[:]
+        self.emitAll(obj, count)
+        self.assertEqual(received, [(i, i) for i in range(count)])
+
 if __name__ == '__main__':
     unittest.main()
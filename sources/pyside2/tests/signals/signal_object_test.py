@@ -30,7 +30,7 @@
 
 import unittest
 
-from PySide2.QtCore import QTimer, Signal, QObject, Slot, Qt
+from PySide2.QtCore import QTimer, Signal, QObject, Slot, Qt, SIGNAL
 from helper import UsesQCoreApplication
 
 class MyObject(QTimer):
@@ -111,5 +111,46 @@ class SignalObjectTest(UsesQCoreApplication):
         o.sig6.emit(arg)
         self.assertEqual(arg, o._o)
 
+    def testSignalInstanceIsKept(self):
+        o = MyObject()
+        for name in ('sig1', 'sig2', 'timeout', 'destroyed'):
+            self.assertTrue(getattr(o, name) is getattr(o, name))
+        # Signals found in the meta object are not kept in the instance dict.
+        self.assertFalse('sig1' in o.__dict__)
+        self.assertFalse('timeout' in o.__dict__)
+
+    def testAssignmentAfterAccess(self):
+        o = MyObject()
+        self.assertTrue(o.sig1 is o.sig1)
+        self.assertTrue(o.timeout is o.timeout)
+        o.sig1 = 'replaced'
+        o.timeout = 42
+        self.assertEqual(o.sig1, 'replaced')
+        self.assertEqual(o.timeout, 42)
+        del o.sig1
+        self.assertEqual(o.sig1.__class__.__name__, 'SignalInstance')
+
+    def testClassAttributeAfterAccess(self):
+        class Patched(QObject):
+            changed = Signal()
+
+        o = Patched()
+        o.changed
+        Patched.changed = 'patched'
+        self.assertEqual(o.changed, 'patched')
+
+    def testDynamicSignalAttribute(self):
+        o = QObject()
+        values = []
+        o.connect(SIGNAL('firstChanged(int)'), values.append)
+        first = o.firstChanged
+        self.assertTrue(o.firstChanged is first)
+        first.emit(1)
+        # Adding another signal changes the meta object of the instance.
+        o.connect(SIGNAL('secondChanged(int)'), values.append)
+        o.firstChanged.emit(2)
+        o.secondChanged.emit(3)
+        self.assertEqual(values, [1, 2, 3])
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+
+#############################################################################
+##
+## Copyright (C) 2016 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+
+'''Test cases for calling Python slots through the meta object system.'''
+
+import unittest
+
+from PySide2.QtCore import QObject, Signal, Slot, SIGNAL, SLOT
+
+class Receiver(QObject):
+    valueChanged = Signal(int, str)
+
+    def __init__(self, parent=None):
+        QObject.__init__(self, parent)
+        self.received = []
+
+    @Slot(int, str)
+    def onValueChanged(self, value, text):
+        self.received.append((value, text))
+
+class DerivedReceiver(Receiver):
+    def onValueChanged(self, value, text):
+        self.received.append(('derived', value, text))
+
+class SlotDispatchTest(unittest.TestCase):
+
+    def testArguments(self):
+        r = Receiver()
+        r.connect(SIGNAL('valueChanged(int,QString)'), r, SLOT('onValueChanged(int,QString)'))
+        r.valueChanged.emit(1, 'one')
+        r.valueChanged.emit(2, 'two')
+        self.assertEqual(r.received, [(1, 'one'), (2, 'two')])
+
+    def testOverrideInSubclass(self):
+        r = DerivedReceiver()
+        r.connect(SIGNAL('valueChanged(int,QString)'), r, SLOT('onValueChanged(int,QString)'))
+        r.valueChanged.emit(3, 'three')
+        self.assertEqual(r.received, [('derived', 3, 'three')])
+
+    def testOverrideInInstance(self):
+        r = Receiver()
+        r.connect(SIGNAL('valueChanged(int,QString)'), r, SLOT('onValueChanged(int,QString)'))
+        calls = []
+        r.onValueChanged = lambda value, text: calls.append(value)
+        r.valueChanged.emit(4, 'four')
+        self.assertEqual(calls, [4])
+        self.assertEqual(r.received, [])
+
+if __name__ == '__main__':
+    unittest.main()
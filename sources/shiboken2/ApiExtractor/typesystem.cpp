@@ -786,9 +786,12 @@ bool Handler::startElement(const QStringRef &n, const QXmlStreamAttributes &atts
             break;
         case StackElement::ValueTypeEntry:
             attributes.insert(QLatin1String("default-constructor"), QString());
+            attributes.insert(QLatin1String("freelist"), QString());
+            attributes.insert(QLatin1String("inline-storage"), noAttributeValue());
             Q_FALLTHROUGH();
         case StackElement::ObjectTypeEntry:
             attributes.insert(QLatin1String("force-abstract"), noAttributeValue());
+            attributes.insert(QLatin1String("destructor-gil"), QString());
             attributes.insert(QLatin1String("deprecated"), noAttributeValue());
             attributes.insert(QLatin1String("hash-function"), QString());
             attributes.insert(QLatin1String("stream"), noAttributeValue());
@@ -1004,6 +1007,20 @@ bool Handler::startElement(const QStringRef &n, const QXmlStreamAttributes &atts
                 QString defaultConstructor = attributes[QLatin1String("default-constructor")];
                 if (!defaultConstructor.isEmpty())
                     typeEntry->setDefaultConstructor(defaultConstructor);
+                const QString freeList = attributes[QLatin1String("freelist")];
+                if (!freeList.isEmpty()) {
+                    bool ok;
+                    const int freeListSize = freeList.toInt(&ok);
+                    if (!ok || freeListSize < 0) {
+                        m_error = QStringLiteral("Invalid free list size '%1' of value type %2")
+                                  .arg(freeList, name);
+                        delete typeEntry;
+                        return false;
+                    }
+                    typeEntry->setFreeListSize(freeListSize);
+                }
+                typeEntry->setInlineStorage(convertBoolean(attributes[QLatin1String("inline-storage")],
+                                                           QLatin1String("inline-storage"), false));
                 element->entry = typeEntry;
             }
 
@@ -1058,6 +1075,18 @@ bool Handler::startElement(const QStringRef &n, const QXmlStreamAttributes &atts
                     ctype->setTypeFlags(ctype->typeFlags() | ComplexTypeEntry::ForceAbstract);
                 if (convertBoolean(attributes[QLatin1String("deprecated")], QLatin1String("deprecated"), false))
                     ctype->setTypeFlags(ctype->typeFlags() | ComplexTypeEntry::Deprecated);
+                const QString destructorGil = attributes[QLatin1String("destructor-gil")].toLower();
+                if (destructorGil == QLatin1String("keep")) {
+                    ctype->setDestructorGil(ComplexTypeEntry::DestructorKeepsGil);
+                } else if (destructorGil == QLatin1String("release")) {
+                    ctype->setDestructorGil(ComplexTypeEntry::DestructorReleasesGil);
+                } else if (destructorGil == QLatin1String("deferred")) {
+                    ctype->setDestructorGil(ComplexTypeEntry::DestructorDeferred);
+                } else if (!destructorGil.isEmpty()) {
+                    qCWarning(lcShiboken).noquote().nospace()
+                        << QStringLiteral("Value '%1' not supported in attribute 'destructor-gil' of %2. "
+                                          "Use 'keep', 'release' or 'deferred'.").arg(destructorGil, name);
+                }
             }
 
             if (element->type == StackElement::InterfaceTypeEntry
@@ -1228,6 +1228,13 @@ public:
         Unknown
     };
 
+    enum DestructorGilFlag {
+        DestructorGilUnspecified,
+        DestructorKeepsGil,
+        DestructorReleasesGil,
+        DestructorDeferred
+    };
+
     explicit ComplexTypeEntry(const QString &name, Type t, const QVersionNumber &vr);
 
     bool isComplex() const override;
@@ -1387,6 +1394,33 @@ public:
         m_hashFunction = hashFunction;
     }
 
+    int freeListSize() const
+    {
+        return m_freeListSize;
+    }
+    void setFreeListSize(int size)
+    {
+        m_freeListSize = size;
+    }
+
+    DestructorGilFlag destructorGil() const
+    {
+        return m_destructorGil;
+    }
+    void setDestructorGil(DestructorGilFlag flag)
+    {
+        m_destructorGil = flag;
+    }
+
+    bool hasInlineStorage() const
+    {
+        return m_inlineStorage;
+    }
+    void setInlineStorage(bool inlineStorage)
+    {
+        m_inlineStorage = inlineStorage;
+    }
+
     void setBaseContainerType(const ComplexTypeEntry *baseContainer)
     {
         m_baseContainerType = baseContainer;
@@ -1421,6 +1455,9 @@ private:
     TypeFlags m_typeFlags;
     CopyableFlag m_copyableFlag = Unknown;
     QString m_hashFunction;
+    int m_freeListSize = 0;
+    bool m_inlineStorage = false;
+    DestructorGilFlag m_destructorGil = DestructorGilUnspecified;
 
     const ComplexTypeEntry* m_baseContainerType = nullptr;
 };
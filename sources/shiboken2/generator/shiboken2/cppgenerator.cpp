@@ -750,8 +750,9 @@ void CppGenerator::writeVirtualMethodNative(QTextStream&s, const AbstractMetaFun
         s << INDENT << "return " << defaultReturnExpr << ';' << endl;
     }
 
-    s << INDENT << "Shiboken::AutoDecRef " PYTHON_OVERRIDE_VAR "(Shiboken::BindingManager::instance().getOverride(this, \"";
-    s << funcName << "\"));" << endl;
+    s << INDENT << "static PyObject* pyFuncName = Shiboken::String::createStaticString(\""
+        << funcName << "\");" << endl;
+    s << INDENT << "Shiboken::AutoDecRef " PYTHON_OVERRIDE_VAR "(Shiboken::BindingManager::instance().getOverride(this, pyFuncName));" << endl;
 
     s << INDENT << "if (" PYTHON_OVERRIDE_VAR ".isNull()) {" << endl;
     {
@@ -1199,8 +1200,23 @@ void CppGenerator::writeConverterFunctions(QTextStream &s, const AbstractMetaCla
     else
         computedWrapperName = wrapperName(classContext.preciseType());
 
-    c << INDENT << "return Shiboken::Object::newObject(" << cpythonType << ", new ::" << computedWrapperName;
-    c << "(*((" << typeName << "*)cppIn)), true, true);";
+    if (!classContext.forSmartPointer() && hasInlineStorage(metaClass)) {
+        // The copy is constructed inside the memory of its wrapper.
+        c << INDENT << "void* storage;" << endl;
+        c << INDENT << "PyObject* pyOut = Shiboken::Object::newObjectWithInlineStorage(" << cpythonType << ", &storage);" << endl;
+        c << INDENT << "if (pyOut)" << endl;
+        {
+            Indentation indent(INDENT);
+            c << INDENT << "new (storage) ::" << metaClass->qualifiedCppName()
+              << "(*((" << typeName << "*)cppIn));" << endl;
+        }
+        c << INDENT << "return pyOut;";
+    } else {
+        const QString newExpression = !classContext.forSmartPointer() && freeListSize(metaClass) > 0
+            ? freeListNew(metaClass) : QLatin1String("new ::");
+        c << INDENT << "return Shiboken::Object::newObject(" << cpythonType << ", " << newExpression << computedWrapperName;
+        c << "(*((" << typeName << "*)cppIn)), true, true);";
+    }
     writeCppToPythonFunction(s, code, sourceTypeName, targetTypeName);
     s << endl;
 
@@ -1512,13 +1528,21 @@ void CppGenerator::writeMethodWrapperPreamble(QTextStream &s, OverloadData &over
         writeUnusedVariableCast(s, QLatin1String(PYTHON_TO_CPP_VAR));
     }
 
-    if (usesNamedArguments && !rfunc->isCallOperator())
+    if (usesNamedArguments && !rfunc->isCallOperator()) {
+        const bool fastCall = usesFastCall(overloadData);
+        if (fastCall) {
+            s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+            s << INDENT << "int numNamedArgs = (kwnames ? int(PyTuple_GET_SIZE(kwnames)) : 0);" << endl;
+            s << "#else" << endl;
+        }
         s << INDENT << "int numNamedArgs = (kwds ? PyDict_Size(kwds) : 0);" << endl;
+        if (fastCall)
+            s << "#endif" << endl;
+    }
 
     if (initPythonArguments) {
-        s << INDENT << "int numArgs = ";
         if (minArgs == 0 && maxArgs == 1 && !rfunc->isConstructor() && !pythonFunctionWrapperUsesListOfArguments(overloadData))
-            s << "(" PYTHON_ARG " == 0 ? 0 : 1);" << endl;
+            s << INDENT << "int numArgs = (" PYTHON_ARG " == 0 ? 0 : 1);" << endl;
         else
             writeArgumentsInitializer(s, overloadData);
     }
@@ -1625,10 +1649,10 @@ void CppGenerator::writeConstructorWrapper(QTextStream &s, const AbstractMetaFun
         s << INDENT << "Shiboken::Object::setHasCppWrapper(sbkSelf, true);" << endl;
     // Need to check if a wrapper for same pointer is already registered
     // Caused by bug PYSIDE-217, where deleted objects' wrappers are not released
-    s << INDENT << "if (Shiboken::BindingManager::instance().hasWrapper(cptr)) {" << endl;
+    s << INDENT << "if (SbkObject* existingWrapper = Shiboken::BindingManager::instance().retrieveWrapper(cptr)) {" << endl;
     {
         Indentation indent(INDENT);
-        s << INDENT << "Shiboken::BindingManager::instance().releaseWrapper(Shiboken::BindingManager::instance().retrieveWrapper(cptr));" << endl;
+        s << INDENT << "Shiboken::BindingManager::instance().releaseWrapper(existingWrapper);" << endl;
     }
     s << INDENT << "}" << endl;
     s << INDENT << "Shiboken::BindingManager::instance().registerWrapper(sbkSelf, cptr);" << endl;
@@ -1695,7 +1719,14 @@ void CppGenerator::writeMethodWrapper(QTextStream &s, const AbstractMetaFunction
 
     s << "static PyObject* ";
     s << cpythonFunctionName(rfunc) << "(PyObject* " PYTHON_SELF_VAR;
-    if (maxArgs > 0) {
+    if (usesFastCall(overloadData)) {
+        const bool hasKeywords = overloadData.hasArgumentWithDefaultValue();
+        s << ',' << endl << "#ifdef SBK_HAVE_FASTCALL" << endl;
+        s << "    PyObject* const* args, Py_ssize_t nargs" << (hasKeywords ? ", PyObject* kwnames" : "") << endl;
+        s << "#else" << endl;
+        s << "    PyObject* args" << (hasKeywords ? ", PyObject* kwds" : "") << endl;
+        s << "#endif" << endl;
+    } else if (maxArgs > 0) {
         s << ", PyObject* " << (pythonFunctionWrapperUsesListOfArguments(overloadData) ? "args" : PYTHON_ARG);
         if (overloadData.hasArgumentWithDefaultValue() || rfunc->isCallOperator())
             s << ", PyObject* kwds";
@@ -1786,10 +1817,37 @@ void CppGenerator::writeMethodWrapper(QTextStream &s, const AbstractMetaFunction
     s << '}' << endl << endl;
 }
 
+bool CppGenerator::usesFastCall(const OverloadData& overloadData)
+{
+    if (!useFastCall() || !pythonFunctionWrapperUsesListOfArguments(overloadData) || overloadData.hasVarargs())
+        return false;
+    // Constructors, call operators and other operators are installed as type slots,
+    // which CPython always calls with an argument tuple.
+    const AbstractMetaFunction* rfunc = overloadData.referenceFunction();
+    if (rfunc->isConstructor() || rfunc->isCallOperator() || rfunc->isOperatorOverload()
+        || m_tpFuncs.contains(rfunc->name())) {
+        return false;
+    }
+    const OverloadData::MetaFunctionList &overloads = overloadData.overloads();
+    for (const AbstractMetaFunction *func : overloads) {
+        if (injectedCodeUsesArgumentTuple(func))
+            return false;
+    }
+    return true;
+}
+
 void CppGenerator::writeArgumentsInitializer(QTextStream& s, OverloadData& overloadData)
 {
     const AbstractMetaFunction* rfunc = overloadData.referenceFunction();
-    s << "PyTuple_GET_SIZE(args);" << endl;
+    const bool fastCall = usesFastCall(overloadData);
+    if (fastCall) {
+        s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+        s << INDENT << "int numArgs = int(nargs);" << endl;
+        s << "#else" << endl;
+    }
+    s << INDENT << "int numArgs = PyTuple_GET_SIZE(args);" << endl;
+    if (fastCall)
+        s << "#endif" << endl;
 
     int minArgs = overloadData.minArgs();
     int maxArgs = overloadData.maxArgs();
@@ -1861,6 +1919,16 @@ void CppGenerator::writeArgumentsInitializer(QTextStream& s, OverloadData& overl
     else
         funcName = rfunc->name();
 
+    if (fastCall) {
+        s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+        s << INDENT << "if (!Shiboken::unpackFastCallArguments(args, nargs, \"" << funcName << "\", "
+            << (usesNamedArguments ? 0 : minArgs) << ", " << maxArgs << ", " PYTHON_ARGS "))" << endl;
+        {
+            Indentation indent(INDENT);
+            s << INDENT << "return " << m_currentErrorCode << ';' << endl;
+        }
+        s << "#else" << endl;
+    }
     QString argsVar = overloadData.hasVarargs() ?  QLatin1String("nonvarargs") : QLatin1String("args");
     s << INDENT << "if (!";
     if (usesNamedArguments)
@@ -1875,6 +1943,8 @@ void CppGenerator::writeArgumentsInitializer(QTextStream& s, OverloadData& overl
         Indentation indent(INDENT);
         s << INDENT << "return " << m_currentErrorCode << ';' << endl;
     }
+    if (fastCall)
+        s << "#endif" << endl;
     s << endl;
 }
 
@@ -1967,9 +2037,8 @@ void CppGenerator::writeErrorSection(QTextStream& s, OverloadData& overloadData)
 
     QString argsVar = pythonFunctionWrapperUsesListOfArguments(overloadData)
         ? QLatin1String("args") : QLatin1String(PYTHON_ARG);
-    if (verboseErrorMessagesDisabled()) {
-        s << INDENT << "Shiboken::setErrorAboutWrongArguments(" << argsVar << ", \"" << funcName << "\", 0);" << endl;
-    } else {
+    QString overloadsVar = QLatin1String("0");
+    if (!verboseErrorMessagesDisabled()) {
         QStringList overloadSignatures;
         const OverloadData::MetaFunctionList &overloads = overloadData.overloads();
         for (const AbstractMetaFunction *f : overloads) {
@@ -2051,8 +2120,17 @@ void CppGenerator::writeErrorSection(QTextStream& s, OverloadData& overloadData)
         }
         s << INDENT << "const char* overloads[] = {" << overloadSignatures.join(QLatin1String(", "))
               << ", 0};" << endl;
-        s << INDENT << "Shiboken::setErrorAboutWrongArguments(" << argsVar << ", \"" << funcName << "\", overloads);" << endl;
+        overloadsVar = QLatin1String("overloads");
     }
+    const bool fastCall = usesFastCall(overloadData);
+    if (fastCall) {
+        s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+        s << INDENT << "Shiboken::setErrorAboutWrongArguments(args, nargs, \"" << funcName << "\", " << overloadsVar << ");" << endl;
+        s << "#else" << endl;
+    }
+    s << INDENT << "Shiboken::setErrorAboutWrongArguments(" << argsVar << ", \"" << funcName << "\", " << overloadsVar << ");" << endl;
+    if (fastCall)
+        s << "#endif" << endl;
     s << INDENT << "return " << m_currentErrorCode << ';' << endl;
 }
 
@@ -2232,6 +2310,15 @@ static inline QString arrayHandleType(const AbstractMetaTypeCList &nestedArrayTy
             + QStringLiteral(", ")
             + QString::number(nestedArrayTypes.constFirst()->arrayElementCount())
             + QLatin1Char('>');
+    case 0:
+        break;
+    default: {
+        QString result = QStringLiteral("Shiboken::Conversions::ArrayNHandle<")
+            + nestedArrayTypes.constLast()->minimalSignature();
+        for (int i = 0, last = nestedArrayTypes.size() - 1; i < last; ++i)
+            result += QStringLiteral(", ") + QString::number(nestedArrayTypes.at(i)->arrayElementCount());
+        return result + QLatin1Char('>');
+    }
     }
     return QString();
 }
@@ -2620,7 +2707,7 @@ void CppGenerator::writeSingleFunctionCall(QTextStream &s,
     bool usePyArgs = pythonFunctionWrapperUsesListOfArguments(overloadData);
 
     // Handle named arguments.
-    writeNamedArgumentResolution(s, func, usePyArgs);
+    writeNamedArgumentResolution(s, func, usePyArgs, usesFastCall(overloadData));
 
     bool injectCodeCallsFunc = injectedCodeCallsCppFunction(func);
     bool mayHaveUnunsedArguments = !func->isUserAdded() && func->hasInjectedCode() && injectCodeCallsFunc;
@@ -2939,7 +3026,8 @@ void CppGenerator::writeAddPythonToCppConversion(QTextStream& s, const QString&
     s << ");" << endl;
 }
 
-void CppGenerator::writeNamedArgumentResolution(QTextStream& s, const AbstractMetaFunction* func, bool usePyArgs)
+void CppGenerator::writeNamedArgumentResolution(QTextStream& s, const AbstractMetaFunction* func, bool usePyArgs,
+                                                bool fastCall)
 {
     const AbstractMetaArgumentList &args = OverloadData::getArgumentsWithDefaultValues(func);
     if (args.isEmpty())
@@ -2948,16 +3036,40 @@ void CppGenerator::writeNamedArgumentResolution(QTextStream& s, const AbstractMe
     QString pyErrString(QLatin1String("PyErr_SetString(PyExc_TypeError, \"") + fullPythonFunctionName(func)
                         + QLatin1String("(): got multiple values for keyword argument '%1'.\");"));
 
+    if (fastCall) {
+        s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+        s << INDENT << "if (kwnames) {" << endl;
+        s << "#else" << endl;
+    }
     s << INDENT << "if (kwds) {" << endl;
+    if (fastCall)
+        s << "#endif" << endl;
     {
         Indentation indent(INDENT);
-        s << INDENT << "PyObject* ";
-        for (const AbstractMetaArgument *arg : args) {
+        if (fastCall) {
+            // Interned once, so that matching against kwnames is usually a pointer comparison.
+            QStringList kwNames;
+            for (const AbstractMetaArgument *arg : args)
+                kwNames << QLatin1String("Shiboken::String::createStaticString(\"") + arg->name() + QLatin1String("\")");
+            s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+            s << INDENT << "static PyObject* const kwNames[] = {" << kwNames.join(QLatin1String(", ")) << "};" << endl;
+            s << "#endif" << endl;
+        }
+        s << INDENT << "PyObject* value;" << endl;
+        for (int i = 0; i < args.size(); ++i) {
+            const AbstractMetaArgument *arg = args.at(i);
             int pyArgIndex = arg->argumentIndex() - OverloadData::numberOfRemovedArguments(func, arg->argumentIndex());
             QString pyArgName = usePyArgs
                 ? QString::fromLatin1(PYTHON_ARGS "[%1]").arg(pyArgIndex)
                 : QLatin1String(PYTHON_ARG);
-            s << "value = PyDict_GetItemString(kwds, \"" << arg->name() << "\");" << endl;
+            if (fastCall) {
+                s << "#ifdef SBK_HAVE_FASTCALL" << endl;
+                s << INDENT << "value = Shiboken::fastCallKeywordValue(args + nargs, kwnames, kwNames[" << i << "]);" << endl;
+                s << "#else" << endl;
+            }
+            s << INDENT << "value = PyDict_GetItemString(kwds, \"" << arg->name() << "\");" << endl;
+            if (fastCall)
+                s << "#endif" << endl;
             s << INDENT << "if (value && " << pyArgName << ") {" << endl;
             {
                 Indentation indent(INDENT);
@@ -2977,8 +3089,6 @@ void CppGenerator::writeNamedArgumentResolution(QTextStream& s, const AbstractMe
                 }
             }
             s << INDENT << '}' << endl;
-            if (arg != args.constLast())
-                s << INDENT;
         }
     }
     s << INDENT << '}' << endl;
@@ -3168,9 +3278,11 @@ void CppGenerator::writeMethodCall(QTextStream &s, const AbstractMetaFunction *f
             if (func->isConstructor()) {
                 isCtor = true;
                 QString className = wrapperName(func->ownerClass());
+                const QString newExpression = freeListSize(func->ownerClass()) > 0
+                    ? freeListNew(func->ownerClass()) : QLatin1String("new ::");
 
                 if (func->functionType() == AbstractMetaFunction::CopyConstructorFunction && maxArgs == 1) {
-                    mc << "new ::" << className << "(*" << CPP_ARG0 << ')';
+                    mc << newExpression << className << "(*" << CPP_ARG0 << ')';
                 } else {
                     QString ctorCall = className + QLatin1Char('(') + userArgs.join(QLatin1String(", ")) + QLatin1Char(')');
                     if (usePySideExtensions() && func->ownerClass()->isQObject()) {
@@ -3194,7 +3306,7 @@ void CppGenerator::writeMethodCall(QTextStream &s, const AbstractMetaFunction *f
                         }
                         uva << INDENT << "}" << endl;
                     } else {
-                        mc << "new ::" << ctorCall;
+                        mc << newExpression << ctorCall;
                     }
                 }
             } else {
@@ -4149,10 +4261,10 @@ void CppGenerator::writeGetterFunction(QTextStream &s,
         }
         s << INDENT << "}\n";
         // Check if field wrapper has already been created.
-        s << INDENT << "else if (Shiboken::BindingManager::instance().hasWrapper(" << cppField << ")) {" << "\n";
+        s << INDENT << "else if ((pyOut = reinterpret_cast<PyObject *>(Shiboken::BindingManager::instance().retrieveWrapper("
+                    << cppField << ")))) {" << "\n";
         {
             Indentation indent(INDENT);
-            s << INDENT << "pyOut = (PyObject*)Shiboken::BindingManager::instance().retrieveWrapper(" << cppField << ");" << "\n";
             s << INDENT << "Py_IncRef(pyOut);" << "\n";
             s << INDENT << "return pyOut;" << "\n";
         }
@@ -4370,7 +4482,7 @@ void CppGenerator::writeMethodDefinitionEntry(QTextStream& s, const AbstractMeta
         else
             s << "METH_O";
     } else {
-        s << "METH_VARARGS";
+        s << (usesFastCall(overloadData) ? "SBK_METH_FASTCALL" : "METH_VARARGS");
         if (overloadData.hasArgumentWithDefaultValue())
             s << "|METH_KEYWORDS";
     }
@@ -4730,6 +4842,61 @@ void CppGenerator::writeFlagsUnaryOperator(QTextStream& s, const AbstractMetaEnu
     s << '}' << endl << endl;
 }
 
+// Returns the size of the free list of wrappers and C++ instances declared for
+// \p metaClass, or 0 if it has none or needs a C++ wrapper class.
+int CppGenerator::freeListSize(const AbstractMetaClass *metaClass) const
+{
+    const ComplexTypeEntry *typeEntry = metaClass->typeEntry();
+    if (!typeEntry->isValue() || typeEntry->freeListSize() <= 0
+        || metaClass->hasPrivateDestructor() || shouldGenerateCppWrapper(metaClass)) {
+        return 0;
+    }
+    return typeEntry->freeListSize();
+}
+
+// Returns the placement new expression prefix creating an instance of \p metaClass
+// on memory taken from its free list, to be followed by the constructor call.
+QString CppGenerator::freeListNew(const AbstractMetaClass *metaClass) const
+{
+    const QString className = metaClass->qualifiedCppName();
+    return QLatin1String("new (Shiboken::ObjectType::allocateCppObject(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType< ::")
+        + className + QLatin1String(" >()), sizeof(::") + className + QLatin1String("))) ::");
+}
+
+// Returns whether copies of \p metaClass converted to Python are stored inside their
+// wrappers, which the type system requests for small value types.
+bool CppGenerator::hasInlineStorage(const AbstractMetaClass *metaClass) const
+{
+    const ComplexTypeEntry *typeEntry = metaClass->typeEntry();
+    return typeEntry->isValue() && typeEntry->hasInlineStorage()
+        && !metaClass->hasPrivateDestructor() && !shouldGenerateCppWrapper(metaClass);
+}
+
+// Writes how the C++ destructor of \p metaClass is run with respect to the GIL. Unless the
+// type system says otherwise, trivially destructible value types keep it.
+void CppGenerator::writeDestructorGil(QTextStream &s, const AbstractMetaClass *metaClass,
+                                      const QString &pyTypeName)
+{
+    const ComplexTypeEntry *typeEntry = metaClass->typeEntry();
+    switch (typeEntry->destructorGil()) {
+    case ComplexTypeEntry::DestructorKeepsGil:
+        s << INDENT << "Shiboken::ObjectType::setDestructorKeepsGil(" << pyTypeName << ", true);" << endl << endl;
+        break;
+    case ComplexTypeEntry::DestructorDeferred:
+        s << INDENT << "Shiboken::ObjectType::setDeferredDestruction(" << pyTypeName << ", true);" << endl << endl;
+        break;
+    case ComplexTypeEntry::DestructorGilUnspecified:
+        if (typeEntry->isValue() && !shouldGenerateCppWrapper(metaClass)) {
+            s << INDENT << "Shiboken::ObjectType::setDestructorKeepsGil(" << pyTypeName
+              << ", std::is_trivially_destructible< ::" << metaClass->qualifiedCppName() << " >::value);"
+              << endl << endl;
+        }
+        break;
+    case ComplexTypeEntry::DestructorReleasesGil:
+        break;
+    }
+}
+
 QString CppGenerator::getInitFunctionName(GeneratorContext &context) const
 {
     QString initFunctionName;
@@ -4764,6 +4931,31 @@ void CppGenerator::writeClassRegister(QTextStream &s,
     while (signatureStream.readLineInto(&line))
         s << INDENT << '"' << line << "\\n\"" << endl;
     s << ';' << endl << endl;
+
+    const int freeList = classContext.forSmartPointer() ? 0 : freeListSize(metaClass);
+    if (freeList == 0 && classTypeEntry->freeListSize() > 0) {
+        qCWarning(lcShiboken).noquote().nospace()
+            << "The free list of " << metaClass->qualifiedCppName()
+            << " is ignored since the class has a private destructor or needs a wrapper class.";
+    }
+    const bool inlineStorage = !classContext.forSmartPointer() && hasInlineStorage(metaClass);
+    if (!inlineStorage && classTypeEntry->hasInlineStorage()) {
+        qCWarning(lcShiboken).noquote().nospace()
+            << "The inline storage of " << metaClass->qualifiedCppName()
+            << " is ignored since the class has a private destructor or needs a wrapper class.";
+    }
+    const QString freeListDtorName = chopType(pyTypeName) + QLatin1String("_FreeListDtor");
+    if (freeList > 0) {
+        s << "static void " << freeListDtorName << "(void* cptr)" << endl;
+        s << '{' << endl;
+        {
+            Indentation indent(INDENT);
+            s << INDENT << "Shiboken::callCppDestructor< ::" << metaClass->qualifiedCppName()
+              << " >(cptr, " << pyTypeName << ");" << endl;
+        }
+        s << '}' << endl << endl;
+    }
+
     s << "void init_" << initFunctionName;
     s << "(PyObject* " << enclosingObjectVariable << ")" << endl;
     s << '{' << endl;
@@ -4787,6 +4979,10 @@ void CppGenerator::writeClassRegister(QTextStream &s,
     const QString typePtr = QLatin1String("_") + chopType(pyTypeName)
         + QLatin1String("_Type");
 
+    if (inlineStorage) {
+        s << INDENT << chopType(pyTypeName) << "_spec.basicsize = int(Shiboken::ObjectType::inlineStorageOffset(alignof(::"
+          << metaClass->qualifiedCppName() << ")) + sizeof(::" << metaClass->qualifiedCppName() << "));" << endl;
+    }
     s << INDENT << typePtr << " = Shiboken::ObjectType::introduceWrapperType(" << endl;
     {
         Indentation indent(INDENT);
@@ -4827,7 +5023,10 @@ void CppGenerator::writeClassRegister(QTextStream &s,
             if (classContext.forSmartPointer())
                 dtorClassName = wrapperName(classContext.preciseType());
 
-            s << "&Shiboken::callCppDestructor< ::" << dtorClassName << " >," << endl;
+            if (freeList > 0)
+                s << '&' << freeListDtorName << ',' << endl;
+            else
+                s << "&Shiboken::callCppDestructor< ::" << dtorClassName << " >," << endl;
         } else {
             s << "0," << endl;
         }
@@ -4859,6 +5058,16 @@ void CppGenerator::writeClassRegister(QTextStream &s,
     s << INDENT << "    = reinterpret_cast<PyTypeObject*>(" << pyTypeName << ");" << endl;
     s << endl;
 
+    if (freeList > 0)
+        s << INDENT << "Shiboken::ObjectType::setFreeList(" << pyTypeName << ", " << freeList << ");" << endl << endl;
+    if (inlineStorage) {
+        const QString className = metaClass->qualifiedCppName();
+        s << INDENT << "Shiboken::ObjectType::setInlineStorage(" << pyTypeName << ", alignof(::" << className
+          << "), &Shiboken::callCppInlineDestructor< ::" << className << " >);" << endl << endl;
+    }
+    if (!classContext.forSmartPointer() && !metaClass->isNamespace() && !metaClass->hasPrivateDestructor())
+        writeDestructorGil(s, metaClass, pyTypeName);
+
     // Register conversions for the type.
     writeConverterRegister(s, metaClass, classContext);
     s << endl;
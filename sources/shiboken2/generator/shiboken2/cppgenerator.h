@@ -73,6 +73,8 @@ private:
     void writeMethodWrapper(QTextStream &s, const AbstractMetaFunctionList overloads,
                             GeneratorContext &classContext);
     void writeArgumentsInitializer(QTextStream& s, OverloadData& overloadData);
+    /// Returns true if the wrapper for \p overloadData receives its arguments through METH_FASTCALL.
+    bool usesFastCall(const OverloadData& overloadData);
     void writeCppSelfDefinition(QTextStream &s,
                                 const AbstractMetaFunction *func,
                                 GeneratorContext &context,
@@ -218,7 +220,8 @@ private:
 
     void writeAddPythonToCppConversion(QTextStream& s, const QString& converterVar, const QString& pythonToCppFunc, const QString& isConvertibleFunc);
 
-    void writeNamedArgumentResolution(QTextStream& s, const AbstractMetaFunction* func, bool usePyArgs);
+    void writeNamedArgumentResolution(QTextStream& s, const AbstractMetaFunction* func, bool usePyArgs,
+                                      bool fastCall = false);
 
     /// Returns a string containing the name of an argument for the given function and argument index.
     QString argumentNameFromIndex(const AbstractMetaFunction* func, int argIndex, const AbstractMetaClass** wrappedClass);
@@ -227,6 +230,11 @@ private:
 
     QString getInitFunctionName(GeneratorContext &context) const;
 
+    int freeListSize(const AbstractMetaClass *metaClass) const;
+    QString freeListNew(const AbstractMetaClass *metaClass) const;
+    bool hasInlineStorage(const AbstractMetaClass *metaClass) const;
+    void writeDestructorGil(QTextStream &s, const AbstractMetaClass *metaClass, const QString &pyTypeName);
+
     void writeClassRegister(QTextStream &s,
                             const AbstractMetaClass *metaClass,
                             GeneratorContext &classContext,
@@ -46,6 +46,7 @@
 #define ENABLE_PYSIDE_EXTENSIONS "enable-pyside-extensions"
 #define DISABLE_VERBOSE_ERROR_MESSAGES "disable-verbose-error-messages"
 #define USE_ISNULL_AS_NB_NONZERO "use-isnull-as-nb_nonzero"
+#define ENABLE_FASTCALL "enable-fastcall"
 
 //static void dumpFunction(AbstractMetaFunctionList lst);
 
@@ -813,8 +814,12 @@ QString ShibokenGenerator::converterObject(const AbstractMetaType* type)
         return QLatin1String("Shiboken::Conversions::PrimitiveTypeConverter<void*>()");
     const AbstractMetaTypeCList nestedArrayTypes = type->nestedArrayTypes();
     if (!nestedArrayTypes.isEmpty() && nestedArrayTypes.constLast()->isCppPrimitive()) {
-        return QStringLiteral("Shiboken::Conversions::ArrayTypeConverter<")
-            + nestedArrayTypes.constLast()->minimalSignature()
+        // Arrays of non-const elements may be written to by the C++ function.
+        const AbstractMetaType *elementType = nestedArrayTypes.constLast();
+        return QLatin1String(elementType->isConstant()
+                             ? "Shiboken::Conversions::ArrayTypeConverter<"
+                             : "Shiboken::Conversions::WritableArrayTypeConverter<")
+            + elementType->typeEntry()->qualifiedCppName()
             + QLatin1String(">(") + QString::number(nestedArrayTypes.size())
             + QLatin1Char(')');
     }
@@ -1128,6 +1133,8 @@ QString ShibokenGenerator::cpythonCheckFunction(const AbstractMetaType* metaType
     } else if (metaType->typeEntry()->isContainer()) {
         QString typeCheck = QLatin1String("Shiboken::Conversions::");
         ContainerTypeEntry::Type type = ((const ContainerTypeEntry*)metaType->typeEntry())->type();
+        // Only vectors are filled from packed arrays, see packedSequenceToCpp().
+        const bool isContiguous = type == ContainerTypeEntry::VectorContainer;
         if (type == ContainerTypeEntry::ListContainer
             || type == ContainerTypeEntry::StringListContainer
             || type == ContainerTypeEntry::LinkedListContainer
@@ -1139,7 +1146,9 @@ QString ShibokenGenerator::cpythonCheckFunction(const AbstractMetaType* metaType
             if (isPointerToWrapperType(type)) {
                 typeCheck += QString::fromLatin1("checkSequenceTypes(%1, ").arg(cpythonTypeNameExt(type));
             } else if (isWrapperType(type)) {
-                typeCheck += QLatin1String("convertibleSequenceTypes(reinterpret_cast<SbkObjectType *>(");
+                typeCheck += isContiguous
+                    ? QLatin1String("convertibleContiguousSequenceTypes(reinterpret_cast<SbkObjectType *>(")
+                    : QLatin1String("convertibleSequenceTypes(reinterpret_cast<SbkObjectType *>(");
                 typeCheck += cpythonTypeNameExt(type);
                 typeCheck += QLatin1String("), ");
             } else {
@@ -1259,8 +1268,11 @@ QString ShibokenGenerator::cpythonIsConvertibleFunction(const AbstractMetaType*
     const AbstractMetaTypeCList nestedArrayTypes = metaType->nestedArrayTypes();
     if (!nestedArrayTypes.isEmpty() && nestedArrayTypes.constLast()->isCppPrimitive()) {
         const int dim1 = metaType->arrayElementCount();
-        const int dim2 = nestedArrayTypes.constFirst()->isArray()
+        // For more than 2 dimensions, dim2 is the number of elements of a row.
+        int dim2 = nestedArrayTypes.constFirst()->isArray()
             ? nestedArrayTypes.constFirst()->arrayElementCount() : -1;
+        for (int i = 1, last = nestedArrayTypes.size() - 1; dim2 >= 0 && i < last; ++i)
+            dim2 *= nestedArrayTypes.at(i)->arrayElementCount();
         result += QLatin1String(", ") + QString::number(dim1)
             + QLatin1String(", ") + QString::number(dim2);
     }
@@ -2069,6 +2081,18 @@ bool ShibokenGenerator::injectedCodeUsesPySelf(const AbstractMetaFunction* func)
     return false;
 }
 
+bool ShibokenGenerator::injectedCodeUsesArgumentTuple(const AbstractMetaFunction* func)
+{
+    static const QRegularExpression argsRegex(QStringLiteral("\\b(args|kwds)\\b"));
+    Q_ASSERT(argsRegex.isValid());
+    CodeSnipList snips = func->injectedCodeSnips(TypeSystem::CodeSnipPositionAny, TypeSystem::TargetLangCode);
+    for (const CodeSnip &snip : qAsConst(snips)) {
+        if (snip.code().contains(argsRegex))
+            return true;
+    }
+    return false;
+}
+
 bool ShibokenGenerator::injectedCodeCallsCppFunction(const AbstractMetaFunction* func)
 {
     QString funcCall = func->originalName() + QLatin1Char('(');
@@ -2498,6 +2522,9 @@ Generator::OptionDescriptions ShibokenGenerator::options() const
                                    "but safe few kB on the generated bindings."))
         << qMakePair(QLatin1String(PARENT_CTOR_HEURISTIC),
                      QLatin1String("Enable heuristics to detect parent relationship on constructors."))
+        << qMakePair(QLatin1String(ENABLE_FASTCALL),
+                     QLatin1String("Generate METH_FASTCALL method wrappers that do not build argument\n"
+                                   "tuples, when compiled for Python 3.7 or later."))
         << qMakePair(QLatin1String(ENABLE_PYSIDE_EXTENSIONS),
                      QLatin1String("Enable PySide extensions, such as support for signal/slots,\n"
                                    "use this if you are creating a binding for a Qt-based library."))
@@ -2542,6 +2569,7 @@ bool ShibokenGenerator::doSetup(const QMap<QString, QString>& args)
     m_verboseErrorMessagesDisabled = args.contains(QLatin1String(DISABLE_VERBOSE_ERROR_MESSAGES));
     m_useIsNullAsNbNonZero = args.contains(QLatin1String(USE_ISNULL_AS_NB_NONZERO));
     m_avoidProtectedHack = args.contains(QLatin1String(AVOID_PROTECTED_HACK));
+    m_useFastCall = args.contains(QLatin1String(ENABLE_FASTCALL));
 
     TypeDatabase* td = TypeDatabase::instance();
     QStringList snips;
@@ -2611,6 +2639,11 @@ bool ShibokenGenerator::avoidProtectedHack() const
     return m_avoidProtectedHack;
 }
 
+bool ShibokenGenerator::useFastCall() const
+{
+    return m_useFastCall;
+}
+
 QString ShibokenGenerator::cppApiVariableName(const QString& moduleName) const
 {
     QString result = moduleName.isEmpty() ? ShibokenGenerator::packageName() : moduleName;
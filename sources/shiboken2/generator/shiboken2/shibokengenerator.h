@@ -199,6 +199,14 @@ public:
      */
     bool injectedCodeUsesPySelf(const AbstractMetaFunction* func);
 
+    /**
+     *   Verifies if any of the function's code injections of the "target"
+     *   type accesses the Python wrapper arguments "args" or "kwds" directly.
+     *   \param func the function to check
+     *   \return true if the function's target code snippets use "args" or "kwds"
+     */
+    bool injectedCodeUsesArgumentTuple(const AbstractMetaFunction* func);
+
     /**
      *   Verifies if any of the function's code injections makes a call
      *   to the C++ method. This is used by the generator to avoid writing calls
@@ -425,6 +433,8 @@ public:
     bool useIsNullAsNbNonZero() const;
     /// Returns true if the generated code should use the "#define protected public" hack.
     bool avoidProtectedHack() const;
+    /// Returns true if method wrappers taking several arguments should use METH_FASTCALL where available.
+    bool useFastCall() const;
     QString cppApiVariableName(const QString& moduleName = QString()) const;
     QString convertersVariableName(const QString& moduleName = QString()) const;
     /**
@@ -523,6 +533,7 @@ private:
     bool m_verboseErrorMessagesDisabled;
     bool m_useIsNullAsNbNonZero;
     bool m_avoidProtectedHack;
+    bool m_useFastCall;
 
     typedef QHash<QString, AbstractMetaType*> AbstractMetaTypeCache;
     AbstractMetaTypeCache m_metaTypeFromStringCache;
@@ -48,9 +48,11 @@
 #include <string>
 #include <cstring>
 #include <cstddef>
+#include <new>
 #include <set>
 #include <sstream>
 #include <algorithm>
+#include <vector>
 #include "threadstatesaver.h"
 #include "signature.h"
 #include "qapp_macro.h"
@@ -65,10 +67,11 @@ extern "C"
 
 static void SbkObjectTypeDealloc(PyObject* pyObj);
 static PyObject* SbkObjectTypeTpNew(PyTypeObject* metatype, PyObject* args, PyObject* kwds);
+static int SbkObjectTypeSetAttro(PyObject* pyObj, PyObject* name, PyObject* value);
 
 static PyType_Slot SbkObjectType_Type_slots[] = {
     {Py_tp_dealloc, (void *)SbkObjectTypeDealloc},
-    {Py_tp_setattro, (void *)PyObject_GenericSetAttr},
+    {Py_tp_setattro, (void *)SbkObjectTypeSetAttro},
     {Py_tp_base, (void *)&PyType_Type},
     {Py_tp_alloc, (void *)PyType_GenericAlloc},
     {Py_tp_new, (void *)SbkObjectTypeTpNew},
@@ -127,11 +130,15 @@ static int SbkObject_traverse(PyObject* self, visitproc visit, void* arg)
     Shiboken::RefCountMap* rInfo = sbkSelf->d->referredObjects;
     if (rInfo) {
         Shiboken::RefCountMap::const_iterator it = rInfo->begin();
-        for (; it != rInfo->end(); ++it) {
-            std::list<PyObject*>::const_iterator ref = it->second.begin();
-            for(; ref != it->second.end(); ++ref)
-                Py_VISIT(*ref);
-        }
+        for (; it != rInfo->end(); ++it)
+            Py_VISIT(it->object);
+    }
+
+    //Visit attribute slots
+    Shiboken::AttributeSlots* slots = sbkSelf->d->attributeSlots;
+    if (slots) {
+        for (std::size_t i = 0; i < slots->objects.size(); ++i)
+            Py_VISIT(slots->objects[i]);
     }
 
     if (sbkSelf->ob_dict)
@@ -166,7 +173,7 @@ static PyType_Slot SbkObject_Type_slots[] = {
 };
 static PyType_Spec SbkObject_Type_spec = {
     "Shiboken.Object",
-    sizeof(SbkObject),
+    sizeof(SbkObjectStorage),
     0,
     Py_TPFLAGS_DEFAULT|Py_TPFLAGS_BASETYPE|Py_TPFLAGS_HAVE_GC,
     SbkObject_Type_slots,
@@ -187,6 +194,57 @@ SbkObjectType *SbkObject_TypeF(void)
 }
 
 
+// C++ instances waiting for their deferred destructor, guarded by the GIL.
+typedef std::vector<std::pair<ObjectDestructor, void*> > DeferredDestructorList;
+static DeferredDestructorList deferredDestructors;
+static bool deferredDestructorsScheduled = false;
+// Bounds the memory held by instances waiting for the interpreter to run the pending call.
+static const std::size_t maxDeferredDestructors = 256;
+
+static int runDeferredDestructorsPendingCall(void*)
+{
+    deferredDestructorsScheduled = false;
+    Shiboken::Object::runDeferredDestructors();
+    return 0;
+}
+
+static void runDeferredDestructorsAtExit()
+{
+    Shiboken::Object::runDeferredDestructors();
+}
+
+static void deferCppDestructor(ObjectDestructor dtor, void* cptr)
+{
+    static bool atExitRegistered = false;
+    if (!atExitRegistered)
+        atExitRegistered = Py_AtExit(runDeferredDestructorsAtExit) == 0;
+
+    deferredDestructors.push_back(std::make_pair(dtor, cptr));
+    if (deferredDestructors.size() >= maxDeferredDestructors)
+        Shiboken::Object::runDeferredDestructors();
+    else if (!deferredDestructorsScheduled)
+        deferredDestructorsScheduled = Py_AddPendingCall(runDeferredDestructorsPendingCall, nullptr) == 0;
+}
+
+// Runs the C++ destructor of an instance of the type described by \p sotp, with the GIL
+// released unless the type keeps it, or queues it when the type defers its destruction.
+static void runCppDestructor(const SbkObjectTypePrivate* sotp, void* cptr, bool mayDefer)
+{
+    if (!Py_IsInitialized()) {
+        sotp->cpp_dtor(cptr);
+        return;
+    }
+    if (sotp->dtor_keeps_gil) {
+        sotp->cpp_dtor(cptr);
+    } else if (mayDefer && sotp->dtor_deferred) {
+        deferCppDestructor(sotp->cpp_dtor, cptr);
+    } else {
+        Shiboken::ThreadStateSaver threadSaver;
+        threadSaver.save();
+        sotp->cpp_dtor(cptr);
+    }
+}
+
 static void SbkDeallocWrapperCommon(PyObject* pyObj, bool canDelete)
 {
     SbkObject* sbkObj = reinterpret_cast<SbkObject*>(pyObj);
@@ -221,12 +279,12 @@ static void SbkDeallocWrapperCommon(PyObject* pyObj, bool canDelete)
             Shiboken::walkThroughClassHierarchy(Py_TYPE(pyObj), &visitor);
         } else {
             void* cptr = sbkObj->d->cptr[0];
+            // A C++ instance stored inside the wrapper must go before its memory does.
+            const bool destroyedInline = Shiboken::ObjectType::destroyInlineCppObject(sbkObj, cptr);
             Shiboken::Object::deallocData(sbkObj, true);
 
-            Shiboken::ThreadStateSaver threadSaver;
-            if (Py_IsInitialized())
-                threadSaver.save();
-            sotp->cpp_dtor(cptr);
+            if (!destroyedInline)
+                runCppDestructor(sotp, cptr, true);
         }
     } else {
         Shiboken::Object::deallocData(sbkObj, true);
@@ -271,6 +329,9 @@ void SbkObjectTypeDealloc(PyObject* pyObj)
         sotp->original_name = nullptr;
         if (!Shiboken::ObjectType::isUserType(type))
             Shiboken::Conversions::deleteConverter(sotp->converter);
+        Py_XDECREF(sotp->override_cache);
+        delete[] sotp->cpp_base_indexes;
+        Shiboken::ObjectType::clearFreeList(type);
         delete sotp;
         sotp = nullptr;
     }
@@ -279,6 +340,17 @@ void SbkObjectTypeDealloc(PyObject* pyObj)
 #endif
 }
 
+// Incremented whenever a class attribute of a Shiboken type changes, see Shiboken::ObjectType::overrideCache.
+static unsigned long typeModificationTag = 1;
+
+int SbkObjectTypeSetAttro(PyObject* pyObj, PyObject* name, PyObject* value)
+{
+    const int result = PyObject_GenericSetAttr(pyObj, name, value);
+    if (result == 0)
+        ++typeModificationTag;
+    return result;
+}
+
 PyObject* SbkObjectTypeTpNew(PyTypeObject* metatype, PyObject* args, PyObject* kwds)
 {
     // Check if all bases are new style before calling type.tp_new
@@ -316,6 +388,26 @@ PyObject* SbkObjectTypeTpNew(PyTypeObject* metatype, PyObject* args, PyObject* k
         }
     }
 
+    // Value types with inline storage enlarge the instance layout of their wrappers, Python cannot
+    // combine two such layouts unless one class derives from the other.
+    const Py_ssize_t plainSize = reinterpret_cast<PyTypeObject *>(SbkObject_TypeF())->tp_basicsize;
+    PyTypeObject* inlineBase = nullptr;
+    for (int i = 0, i_max = PyTuple_GET_SIZE(pyBases); i < i_max; i++) {
+        PyTypeObject* baseType = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(pyBases, i));
+        if (!PyType_IsSubtype(baseType, reinterpret_cast<PyTypeObject *>(SbkObject_TypeF()))
+            || baseType->tp_basicsize == plainSize) {
+            continue;
+        }
+        if (!inlineBase || PyType_IsSubtype(baseType, inlineBase)) {
+            inlineBase = baseType;
+        } else if (!PyType_IsSubtype(inlineBase, baseType)) {
+            PyErr_Format(PyExc_TypeError, "Invalid base classes %s and %s: both store their "
+                "C++ instances inside their wrappers, so they cannot be combined.",
+                inlineBase->tp_name, baseType->tp_name);
+            return 0;
+        }
+    }
+
     // The meta type creates a new type when the Python programmer extends a wrapped C++ class.
     newfunc type_new = reinterpret_cast<newfunc>(PyType_Type.tp_new);
     SbkObjectType *newType = reinterpret_cast<SbkObjectType*>(type_new(metatype, args, kwds));
@@ -333,6 +425,8 @@ PyObject* SbkObjectTypeTpNew(PyTypeObject* metatype, PyObject* args, PyObject* k
         sotp->mi_specialcast = parentType->mi_specialcast;
         sotp->type_discovery = parentType->type_discovery;
         sotp->cpp_dtor = parentType->cpp_dtor;
+        sotp->dtor_keeps_gil = parentType->dtor_keeps_gil;
+        sotp->dtor_deferred = parentType->dtor_deferred;
         sotp->is_multicpp = 0;
         sotp->converter = parentType->converter;
     } else {
@@ -343,6 +437,7 @@ PyObject* SbkObjectTypeTpNew(PyTypeObject* metatype, PyObject* args, PyObject* k
         sotp->cpp_dtor = nullptr;
         sotp->is_multicpp = 1;
         sotp->converter = nullptr;
+        Shiboken::ObjectType::initCppBaseIndexes(newType, bases);
     }
     if (bases.size() == 1)
         sotp->original_name = strdup(PepType_SOTP(bases.front())->original_name);
@@ -361,21 +456,26 @@ PyObject* SbkObjectTypeTpNew(PyTypeObject* metatype, PyObject* args, PyObject* k
     return reinterpret_cast<PyObject*>(newType);
 }
 
-static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype)
+static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype, bool inlineStorage)
 {
     Py_INCREF(reinterpret_cast<PyObject*>(subtype));
-    SbkObjectPrivate* d = new SbkObjectPrivate;
+    SbkObjectStorage* storage = reinterpret_cast<SbkObjectStorage*>(self);
+    SbkObjectPrivate* d = inlineStorage ? new (&storage->d) SbkObjectPrivate : new SbkObjectPrivate;
 
-    SbkObjectTypePrivate * sotp = PepType_SOTP(subtype);
-    int numBases = ((sotp && sotp->is_multicpp) ?
-        Shiboken::getNumberOfCppBaseClasses(subtype) : 1);
-    d->cptr = new void*[numBases];
-    std::memset(d->cptr, 0, sizeof(void*) * size_t(numBases));
+    int numBases = Shiboken::ObjectType::cppPointerCount(subtype);
+    if (inlineStorage && numBases == 1) {
+        storage->cptr = nullptr;
+        d->cptr = &storage->cptr;
+    } else {
+        d->cptr = new void*[numBases];
+        std::memset(d->cptr, 0, sizeof(void*) * size_t(numBases));
+    }
     d->hasOwnership = 1;
     d->containsCppWrapper = 0;
     d->validCppObject = 0;
     d->parentInfo = nullptr;
     d->referredObjects = nullptr;
+    d->attributeSlots = nullptr;
     d->cppObjectCreated = 0;
     self->ob_dict = nullptr;
     self->weakreflist = nullptr;
@@ -385,8 +485,10 @@ static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype)
 
 PyObject* SbkObjectTpNew(PyTypeObject *subtype, PyObject *, PyObject *)
 {
-    SbkObject *self = PyObject_GC_New(SbkObject, subtype);
-    PyObject *res = _setupNew(self, subtype);
+    SbkObject *self = Shiboken::ObjectType::takeFreeWrapper(subtype);
+    if (!self)
+        self = PyObject_GC_New(SbkObject, subtype);
+    PyObject *res = _setupNew(self, subtype, true);
     PyObject_GC_Track(reinterpret_cast<PyObject*>(self));
     return res;
 }
@@ -412,7 +514,8 @@ PyObject* SbkQAppTpNew(PyTypeObject* subtype, PyObject *, PyObject *)
     }
 #endif
     SbkObject* self = reinterpret_cast<SbkObject*>(MakeSingletonQAppWrapper(subtype));
-    return self == 0 ? 0 : _setupNew(self, subtype);
+    // The singleton is a static SbkObject without room for the inline storage.
+    return self == 0 ? 0 : _setupNew(self, subtype, false);
 }
 
 void
@@ -454,7 +557,7 @@ void _destroyParentInfo(SbkObject* obj, bool keepReference)
 namespace Shiboken
 {
 
-static void decRefPyObjectList(const std::list<PyObject*> &pyObj, PyObject* skip = 0);
+static void decRefPyObjectList(const std::vector<PyObject*> &pyObj);
 
 static void _walkThroughClassHierarchy(PyTypeObject* currentType, HierarchyVisitor* visitor)
 {
@@ -523,11 +626,8 @@ void DtorCallerVisitor::visit(SbkObjectType* node)
 void DtorCallerVisitor::done()
 {
     std::list<std::pair<void*, SbkObjectType*> >::const_iterator it = m_ptrs.begin();
-    for (; it != m_ptrs.end(); ++it) {
-        Shiboken::ThreadStateSaver threadSaver;
-        threadSaver.save();
-        PepType_SOTP(it->second)->cpp_dtor(it->first);
-    }
+    for (; it != m_ptrs.end(); ++it)
+        runCppDestructor(PepType_SOTP(it->second), it->first, false);
 }
 
 void DeallocVisitor::done()
@@ -605,6 +705,17 @@ void setErrorAboutWrongArguments(PyObject* args, const char* funcName, const cha
 
 }
 
+void setErrorAboutWrongArguments(PyObject* const* args, Py_ssize_t nargs,
+                                 const char* funcName, const char** cppOverloads)
+{
+    Shiboken::AutoDecRef argsTuple(PyTuple_New(nargs));
+    for (Py_ssize_t i = 0; i < nargs; ++i) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(argsTuple.object(), i, args[i]);
+    }
+    setErrorAboutWrongArguments(argsTuple, funcName, cppOverloads);
+}
+
 class FindBaseTypeVisitor : public HierarchyVisitor
 {
     public:
@@ -641,12 +752,11 @@ std::list<SbkObject*> splitPyObject(PyObject* pyObj)
     return result;
 }
 
-static void decRefPyObjectList(const std::list<PyObject*>& lst, PyObject *skip)
+static void decRefPyObjectList(const std::vector<PyObject*>& lst)
 {
-    std::list<PyObject*>::const_iterator iter = lst.begin();
+    std::vector<PyObject*>::const_iterator iter = lst.begin();
     while(iter != lst.end()) {
-        if (*iter != skip)
-            Py_DECREF(*iter);
+        Py_DECREF(*iter);
         ++iter;
     }
 }
@@ -686,6 +796,46 @@ void* cast(SbkObjectType* sourceType, SbkObject* obj, PyTypeObject* targetType)
         reinterpret_cast<SbkObjectType*>(targetType));
 }
 
+void initCppBaseIndexes(SbkObjectType* type, const std::list<SbkObjectType*>& bases)
+{
+    SbkObjectTypePrivate* sotp = PepType_SOTP(type);
+    std::vector<SbkCppBaseIndex> indexes;
+    int index = 0;
+    for (std::list<SbkObjectType*>::const_iterator it = bases.begin(); it != bases.end(); ++it, ++index) {
+        // A class reachable from several C++ bases is held by the first one, as in GetIndexVisitor.
+        PyObject* mro = reinterpret_cast<PyTypeObject*>(*it)->tp_mro;
+        for (Py_ssize_t i = 0, max = PyTuple_GET_SIZE(mro); i < max; ++i) {
+            PyTypeObject* baseType = reinterpret_cast<PyTypeObject*>(PyTuple_GET_ITEM(mro, i));
+            bool known = false;
+            for (std::size_t j = 0; j < indexes.size() && !known; ++j)
+                known = indexes[j].type == baseType;
+            if (!known) {
+                SbkCppBaseIndex entry = { baseType, index };
+                indexes.push_back(entry);
+            }
+        }
+    }
+    delete[] sotp->cpp_base_indexes;
+    sotp->cpp_base_indexes = new SbkCppBaseIndex[indexes.size() + 1];
+    std::copy(indexes.begin(), indexes.end(), sotp->cpp_base_indexes);
+    sotp->cpp_base_indexes[indexes.size()].type = nullptr;
+    sotp->cpp_base_indexes[indexes.size()].index = -1;
+    sotp->cpp_base_count = int(bases.size());
+}
+
+int cppPointerIndex(PyTypeObject* type, PyTypeObject* desiredType)
+{
+    const SbkObjectTypePrivate* sotp = PepType_SOTP(type);
+    if (!sotp->is_multicpp)
+        return 0;
+    for (const SbkCppBaseIndex* entry = sotp->cpp_base_indexes; entry->type; ++entry) {
+        if (entry->type == desiredType)
+            return entry->index;
+    }
+    // Not part of the hierarchy, GetIndexVisitor ends up at the last C++ base.
+    return sotp->cpp_base_count - 1;
+}
+
 void setCastFunction(SbkObjectType* type, SpecialCastFunction func)
 {
     PepType_SOTP(type)->mi_specialcast = func;
@@ -754,6 +904,13 @@ introduceWrapperType(PyObject *enclosingObject,
     else {
         typeSpec->slots[0].pfunc = reinterpret_cast<void *>(SbkObject_TypeF());
     }
+    // The generated specs only know the public SbkObject struct;
+    // reserve the room for the inline private data.
+    if (typeSpec->basicsize < int(sizeof(SbkObjectStorage)))
+        typeSpec->basicsize = int(sizeof(SbkObjectStorage));
+    // Keep the layout of a base class storing its C++ instances inline.
+    if (baseType && typeSpec->basicsize < reinterpret_cast<PyTypeObject *>(baseType)->tp_basicsize)
+        typeSpec->basicsize = int(reinterpret_cast<PyTypeObject *>(baseType)->tp_basicsize);
     PyObject *heaptype = PyType_FromSpecWithBases(typeSpec, baseTypes);
     Py_TYPE(heaptype) = SbkObjectType_TypeF();
     Py_INCREF(Py_TYPE(heaptype));
@@ -806,6 +963,145 @@ void setTypeUserData(SbkObjectType* type, void* userData, DeleteUserDataFunc d_f
     sotp->d_func = d_func;
 }
 
+void setFreeList(SbkObjectType* type, int capacity)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    if (sotp->freelist || capacity <= 0)
+        return;
+    SbkFreeList* freelist = new SbkFreeList;
+    freelist->capacity = capacity;
+    freelist->wrapperCount = 0;
+    freelist->cppObjectCount = 0;
+    freelist->wrappers = new PyObject*[capacity];
+    freelist->cppObjects = new void*[capacity];
+    sotp->freelist = freelist;
+    // The GIL guards the free list.
+    sotp->dtor_keeps_gil = 1;
+}
+
+void* allocateCppObject(SbkObjectType* type, size_t size)
+{
+    SbkFreeList* freelist = PepType_SOTP(type)->freelist;
+    if (freelist && freelist->cppObjectCount > 0)
+        return freelist->cppObjects[--freelist->cppObjectCount];
+    return ::operator new(size);
+}
+
+void releaseCppObject(SbkObjectType* type, void* memory)
+{
+    // Wrappers of types with a free list destroy their C++ instance with the GIL held.
+    SbkFreeList* freelist = PepType_SOTP(type)->freelist;
+    if (freelist && Py_IsInitialized() && freelist->cppObjectCount < freelist->capacity) {
+        freelist->cppObjects[freelist->cppObjectCount++] = memory;
+    } else {
+        ::operator delete(memory);
+    }
+}
+
+SbkObject* takeFreeWrapper(PyTypeObject* type)
+{
+    SbkFreeList* freelist = PepType_SOTP(type)->freelist;
+    if (!freelist || freelist->wrapperCount == 0)
+        return nullptr;
+    PyObject* wrapper = freelist->wrappers[--freelist->wrapperCount];
+    return reinterpret_cast<SbkObject*>(PyObject_Init(wrapper, type));
+}
+
+bool putFreeWrapper(SbkObject* wrapper)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(Py_TYPE(wrapper));
+    SbkFreeList* freelist = sotp->freelist;
+    if (!freelist || sotp->is_user_type || freelist->wrapperCount == freelist->capacity)
+        return false;
+    freelist->wrappers[freelist->wrapperCount++] = reinterpret_cast<PyObject*>(wrapper);
+    return true;
+}
+
+void clearFreeList(PyTypeObject* type)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    SbkFreeList* freelist = sotp->freelist;
+    if (!freelist)
+        return;
+    while (freelist->wrapperCount > 0)
+        type->tp_free(freelist->wrappers[--freelist->wrapperCount]);
+    while (freelist->cppObjectCount > 0)
+        ::operator delete(freelist->cppObjects[--freelist->cppObjectCount]);
+    delete [] freelist->wrappers;
+    delete [] freelist->cppObjects;
+    delete freelist;
+    sotp->freelist = nullptr;
+}
+
+size_t inlineStorageOffset(size_t alignment)
+{
+    return (sizeof(SbkObjectStorage) + alignment - 1) / alignment * alignment;
+}
+
+void setInlineStorage(SbkObjectType* type, size_t alignment, ObjectDestructor inlineDtor)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    sotp->inline_storage_offset = int(inlineStorageOffset(alignment));
+    sotp->inline_dtor = inlineDtor;
+}
+
+void setDestructorKeepsGil(SbkObjectType* type, bool keepsGil)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    // Types with a free list need the GIL to release their C++ instance memory.
+    sotp->dtor_keeps_gil = keepsGil || sotp->freelist;
+}
+
+void setDeferredDestruction(SbkObjectType* type, bool deferred)
+{
+    PepType_SOTP(type)->dtor_deferred = deferred;
+}
+
+void* inlineStorage(SbkObject* wrapper)
+{
+    const int offset = PepType_SOTP(Py_TYPE(wrapper))->inline_storage_offset;
+    return offset ? reinterpret_cast<char*>(wrapper) + offset : nullptr;
+}
+
+bool destroyInlineCppObject(SbkObject* wrapper, void* cptr)
+{
+    if (!cptr || cptr != inlineStorage(wrapper))
+        return false;
+    // Only copies of value types are stored inline, they are destroyed with the GIL held.
+    PepType_SOTP(Py_TYPE(wrapper))->inline_dtor(cptr);
+    return true;
+}
+
+// Overrides can be cached only if all classes in the MRO notify us of changes,
+// i.e. they are Shiboken types. Plain Python mixins may be patched silently.
+static bool canCacheOverrides(PyTypeObject* type)
+{
+    PyObject* mro = type->tp_mro;
+    PyTypeObject* metaType = SbkObjectType_TypeF();
+    for (Py_ssize_t i = 0, i_max = PyTuple_GET_SIZE(mro); i < i_max; ++i) {
+        PyObject* base = PyTuple_GET_ITEM(mro, i);
+        if (base != reinterpret_cast<PyObject*>(&PyBaseObject_Type)
+            && !PyType_IsSubtype(Py_TYPE(base), metaType)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+PyObject* overrideCache(SbkObjectType* type)
+{
+    SbkObjectTypePrivate* sotp = PepType_SOTP(type);
+    if (!sotp)
+        return nullptr;
+    if (sotp->override_cache_tag != typeModificationTag) {
+        sotp->override_cache_tag = typeModificationTag;
+        Py_CLEAR(sotp->override_cache);
+        if (canCacheOverrides(reinterpret_cast<PyTypeObject*>(type)))
+            sotp->override_cache = PyDict_New();
+    }
+    return sotp->override_cache;
+}
+
 } // namespace ObjectType
 
 
@@ -814,6 +1110,14 @@ namespace Object
 
 static void recursive_invalidate(SbkObject* self, std::set<SbkObject*>& seen);
 
+// Frees the C++ pointer array unless it is the inline slot of the wrapper.
+static void releaseCppPointers(SbkObject* self)
+{
+    if (self->d->cptr != &reinterpret_cast<SbkObjectStorage*>(self)->cptr)
+        delete[] self->d->cptr;
+    self->d->cptr = 0;
+}
+
 bool checkType(PyObject* pyObj)
 {
     return ObjectType::checkType(Py_TYPE(pyObj));
@@ -878,6 +1182,20 @@ bool wasCreatedByPython(SbkObject* pyObj)
     return pyObj->d->cppObjectCreated;
 }
 
+void runDeferredDestructors()
+{
+    if (deferredDestructors.empty())
+        return;
+    // Destructors queued while this batch runs go to a new one.
+    DeferredDestructorList batch;
+    batch.swap(deferredDestructors);
+    Shiboken::ThreadStateSaver threadSaver;
+    if (Py_IsInitialized())
+        threadSaver.save();
+    for (DeferredDestructorList::const_iterator it = batch.begin(); it != batch.end(); ++it)
+        it->first(it->second);
+}
+
 void callCppDestructors(SbkObject* pyObj)
 {
     PyTypeObject *type = Py_TYPE(pyObj);
@@ -885,10 +1203,8 @@ void callCppDestructors(SbkObject* pyObj)
     if (sotp->is_multicpp) {
         Shiboken::DtorCallerVisitor visitor(pyObj);
         Shiboken::walkThroughClassHierarchy(type, &visitor);
-    } else {
-        Shiboken::ThreadStateSaver threadSaver;
-        threadSaver.save();
-        sotp->cpp_dtor(pyObj->d->cptr[0]);
+    } else if (!Shiboken::ObjectType::destroyInlineCppObject(pyObj, pyObj->d->cptr[0])) {
+        runCppDestructor(sotp, pyObj->d->cptr[0], false);
     }
 
     /* invalidate needs to be called before deleting pointer array because
@@ -900,8 +1216,7 @@ void callCppDestructors(SbkObject* pyObj)
       BindingManager::instance().releaseWrapper(pyObj);
     }
 
-    delete[] pyObj->d->cptr;
-    pyObj->d->cptr = 0;
+    releaseCppPointers(pyObj);
     pyObj->d->validCppObject = false;
 }
 
@@ -1011,16 +1326,10 @@ static void recursive_invalidate(SbkObject* self, std::set<SbkObject*>& seen)
 
     // If has ref to other objects invalidate all
     if (self->d->referredObjects) {
+        // Indexed access, since invalidating may change the references.
         RefCountMap& refCountMap = *(self->d->referredObjects);
-        RefCountMap::iterator iter;
-        for (iter = refCountMap.begin(); iter != refCountMap.end(); ++iter) {
-            const std::list<PyObject*> lst = iter->second;
-            std::list<PyObject*>::const_iterator it = lst.begin();
-            while(it != lst.end()) {
-                recursive_invalidate(*it, seen);
-                ++it;
-            }
-        }
+        for (std::size_t i = 0; i < refCountMap.size(); ++i)
+            recursive_invalidate(refCountMap[i].object, seen);
     }
 }
 
@@ -1043,33 +1352,23 @@ void makeValid(SbkObject* self)
     // If has ref to other objects make all valid again
     if (self->d->referredObjects) {
         RefCountMap& refCountMap = *(self->d->referredObjects);
-        RefCountMap::iterator iter;
-        for (iter = refCountMap.begin(); iter != refCountMap.end(); ++iter) {
-            const std::list<PyObject*> lst = iter->second;
-            std::list<PyObject*>::const_iterator it = lst.begin();
-            while(it != lst.end()) {
-                if (Shiboken::Object::checkType(*it))
-                    makeValid(reinterpret_cast<SbkObject*>(*it));
-                ++it;
-            }
+        for (std::size_t i = 0; i < refCountMap.size(); ++i) {
+            if (Shiboken::Object::checkType(refCountMap[i].object))
+                makeValid(reinterpret_cast<SbkObject*>(refCountMap[i].object));
         }
     }
 }
 
 void* cppPointer(SbkObject* pyObj, PyTypeObject* desiredType)
 {
-    PyTypeObject* type = Py_TYPE(pyObj);
-    int idx = 0;
-    if (PepType_SOTP(reinterpret_cast<SbkObjectType*>(type))->is_multicpp)
-        idx = getTypeIndexOnHierarchy(type, desiredType);
     if (pyObj->d->cptr)
-        return pyObj->d->cptr[idx];
+        return pyObj->d->cptr[ObjectType::cppPointerIndex(Py_TYPE(pyObj), desiredType)];
     return 0;
 }
 
 std::vector<void*> cppPointers(SbkObject* pyObj)
 {
-    int n = getNumberOfCppBaseClasses(Py_TYPE(pyObj));
+    int n = ObjectType::cppPointerCount(Py_TYPE(pyObj));
     std::vector<void*> ptrs(n);
     for (int i = 0; i < n; ++i)
         ptrs[i] = pyObj->d->cptr[i];
@@ -1079,10 +1378,7 @@ std::vector<void*> cppPointers(SbkObject* pyObj)
 
 bool setCppPointer(SbkObject* sbkObj, PyTypeObject* desiredType, void* cptr)
 {
-    int idx = 0;
-    PyTypeObject *type = Py_TYPE(sbkObj);
-    if (PepType_SOTP(type)->is_multicpp)
-        idx = getTypeIndexOnHierarchy(type, desiredType);
+    const int idx = ObjectType::cppPointerIndex(Py_TYPE(sbkObj), desiredType);
 
     const bool alreadyInitialized = sbkObj->d->cptr[idx] != 0;
     if (alreadyInitialized)
@@ -1189,13 +1485,9 @@ PyObject *newObject(SbkObjectType* instanceType,
 {
     // Try to find the exact type of cptr.
     if (!isExactType) {
-        PyTypeObject* exactType = 0;
-        if (typeName) {
-            exactType = Shiboken::Conversions::getPythonTypeObject(typeName);
-            if (exactType)
-                instanceType = reinterpret_cast<SbkObjectType*>(exactType);
-        }
-        if (!exactType)
+        if (typeName)
+            instanceType = BindingManager::instance().resolveType(&cptr, instanceType, typeName);
+        else
             instanceType = BindingManager::instance().resolveType(&cptr, instanceType);
     }
 
@@ -1204,9 +1496,7 @@ PyObject *newObject(SbkObjectType* instanceType,
     SbkObject* self = 0;
 
     // Some logic to ensure that colocated child field does not overwrite the parent
-    if (BindingManager::instance().hasWrapper(cptr)) {
-        SbkObject* existingWrapper = BindingManager::instance().retrieveWrapper(cptr);
-
+    if (SbkObject* existingWrapper = BindingManager::instance().retrieveWrapper(cptr)) {
         self = findColocatedChild(existingWrapper, instanceType);
         if (self) {
             // Wrapper already registered for cptr.
@@ -1241,6 +1531,22 @@ PyObject *newObject(SbkObjectType* instanceType,
     return reinterpret_cast<PyObject*>(self);
 }
 
+PyObject* newObjectWithInlineStorage(SbkObjectType* instanceType, void** storage)
+{
+    PyTypeObject* pyType = reinterpret_cast<PyTypeObject*>(instanceType);
+    SbkObject* self = reinterpret_cast<SbkObject*>(SbkObjectTpNew(pyType, 0, 0));
+    if (!self) {
+        *storage = nullptr;
+        return nullptr;
+    }
+    *storage = ObjectType::inlineStorage(self);
+    self->d->cptr[0] = *storage;
+    self->d->hasOwnership = 1;
+    self->d->validCppObject = 1;
+    BindingManager::instance().registerWrapper(self, *storage);
+    return reinterpret_cast<PyObject*>(self);
+}
+
 void destroy(SbkObject* self)
 {
     destroy(self, 0);
@@ -1283,8 +1589,7 @@ void destroy(SbkObject* self, void* cppData)
         self->d->hasOwnership = false;
 
         // the cpp object instance was deleted
-        delete[] self->d->cptr;
-        self->d->cptr = 0;
+        releaseCppPointers(self);
     }
 
     // After this point the object can be death do not use the self pointer bellow
@@ -1406,15 +1711,18 @@ void deallocData(SbkObject* self, bool cleanup)
     if (self->d->cptr) {
         // Remove from BindingManager
         Shiboken::BindingManager::instance().releaseWrapper(self);
-        delete[] self->d->cptr;
-        self->d->cptr = 0;
+        releaseCppPointers(self);
         // delete self->d; PYSIDE-205: wrong!
     }
-    delete self->d; // PYSIDE-205: always delete d.
+    // PYSIDE-205: always delete d.
+    if (self->d == &reinterpret_cast<SbkObjectStorage*>(self)->d)
+        self->d->~SbkObjectPrivate();
+    else
+        delete self->d;
     Py_XDECREF(self->ob_dict);
 
     // PYSIDE-571: qApp is no longer allocated.
-    if (PyObject_IS_GC(reinterpret_cast<PyObject*>(self)))
+    if (PyObject_IS_GC(reinterpret_cast<PyObject*>(self)) && !Shiboken::ObjectType::putFreeWrapper(self))
         Py_TYPE(self)->tp_free(self);
 }
 
@@ -1433,6 +1741,42 @@ void* getTypeUserData(SbkObject* wrapper)
     return PepType_SOTP(Py_TYPE(wrapper))->user_data;
 }
 
+static inline bool sameReferenceKey(const char* entryKey, const char* key)
+{
+    return entryKey == key || std::strcmp(entryKey, key) == 0;
+}
+
+struct ReferenceKeyLess
+{
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
+};
+
+// Returns a copy of \p key that lives as long as the process, since callers
+// may pass temporary strings, e.g. object names.
+static const char* internReferenceKey(const char* key)
+{
+    static std::set<const char*, ReferenceKeyLess> keys;
+    std::set<const char*, ReferenceKeyLess>::const_iterator it = keys.find(key);
+    if (it != keys.end())
+        return *it;
+    const char* copy = strdup(key);
+    keys.insert(copy);
+    return copy;
+}
+
+// Removes the references kept under \p key from \p refCountMap, moving them to \p removed.
+static void takeReferences(RefCountMap& refCountMap, const char* key, std::vector<PyObject*>& removed)
+{
+    RefCountMap::iterator out = refCountMap.begin();
+    for (RefCountMap::iterator it = refCountMap.begin(); it != refCountMap.end(); ++it) {
+        if (sameReferenceKey(it->key, key))
+            removed.push_back(it->object);
+        else
+            *out++ = *it;
+    }
+    refCountMap.erase(out, refCountMap.end());
+}
+
 void keepReference(SbkObject* self, const char* key, PyObject* referredObject, bool append)
 {
     bool isNone = (!referredObject || (referredObject == Py_None));
@@ -1441,33 +1785,45 @@ void keepReference(SbkObject* self, const char* key, PyObject* referredObject, b
         self->d->referredObjects = new Shiboken::RefCountMap;
 
     RefCountMap& refCountMap = *(self->d->referredObjects);
-    RefCountMap::iterator iter = refCountMap.find(key);
-    std::list<PyObject*> objects;
-    if (iter != refCountMap.end()) {
-        objects = (*iter).second;
-        std::list<PyObject*>::const_iterator found = std::find(objects.begin(), objects.end(), referredObject);
-
+    RefCountMap::iterator keyEntry = refCountMap.end();
+    int keyEntryCount = 0;
+    for (RefCountMap::iterator it = refCountMap.begin(); it != refCountMap.end(); ++it) {
+        if (!sameReferenceKey(it->key, key))
+            continue;
         // skip if objects already exists
-        if (found != objects.end())
+        if (it->object == referredObject)
             return;
+        if (keyEntryCount++ == 0)
+            keyEntry = it;
     }
 
-    if (append && !isNone) {
-        refCountMap[key].push_back(referredObject);
-        Py_INCREF(referredObject);
-    } else if (!append) {
-        if (objects.size() > 0)
-            decRefPyObjectList(objects, isNone ? 0 : referredObject);
-        if (isNone) {
-            if (iter != refCountMap.end())
-                refCountMap.erase(iter);
-        } else {
-            objects.clear();
-            objects.push_back(referredObject);
-            refCountMap[key] = objects;
+    if (append) {
+        if (!isNone) {
+            const RefCountEntry entry = {keyEntryCount ? keyEntry->key : internReferenceKey(key), referredObject};
+            refCountMap.push_back(entry);
             Py_INCREF(referredObject);
         }
+        return;
+    }
+
+    // Old references are released once the map is updated, since that may run Python code.
+    if (!isNone && keyEntryCount == 1) {
+        PyObject* oldObject = keyEntry->object;
+        keyEntry->object = referredObject;
+        Py_INCREF(referredObject);
+        Py_DECREF(oldObject);
+        return;
     }
+    const char* internedKey = keyEntryCount ? keyEntry->key : nullptr;
+    std::vector<PyObject*> removed;
+    if (keyEntryCount)
+        takeReferences(refCountMap, key, removed);
+    if (!isNone) {
+        const RefCountEntry entry = {internedKey ? internedKey : internReferenceKey(key), referredObject};
+        refCountMap.push_back(entry);
+        Py_INCREF(referredObject);
+    }
+    decRefPyObjectList(removed);
 }
 
 void removeReference(SbkObject* self, const char* key, PyObject* referredObject)
@@ -1478,24 +1834,62 @@ void removeReference(SbkObject* self, const char* key, PyObject* referredObject)
     if (!self->d->referredObjects)
         return;
 
-    RefCountMap& refCountMap = *(self->d->referredObjects);
-    RefCountMap::iterator iter = refCountMap.find(key);
-    if (iter != refCountMap.end()) {
-        decRefPyObjectList(iter->second);
-        refCountMap.erase(iter);
+    std::vector<PyObject*> removed;
+    takeReferences(*(self->d->referredObjects), key, removed);
+    decRefPyObjectList(removed);
+}
+
+PyObject* getAttributeSlot(SbkObject* self, unsigned int layout, int index)
+{
+    const AttributeSlots* slots = self->d->attributeSlots;
+    if (!slots || slots->layout != layout || index >= int(slots->objects.size()))
+        return 0;
+    return slots->objects[index];
+}
+
+void setAttributeSlot(SbkObject* self, unsigned int layout, int index, PyObject* object)
+{
+    if (!self->d->attributeSlots)
+        self->d->attributeSlots = new AttributeSlots;
+
+    // Old objects are released once the slots are updated, since that may run Python code.
+    AttributeSlots& slots = *(self->d->attributeSlots);
+    std::vector<PyObject*> removed;
+    if (slots.layout != layout) {
+        removed.swap(slots.objects);
+        slots.layout = layout;
     }
+    if (index >= int(slots.objects.size()))
+        slots.objects.resize(index + 1, 0);
+    else
+        removed.push_back(slots.objects[index]);
+    Py_XINCREF(object);
+    slots.objects[index] = object;
+    for (std::size_t i = 0; i < removed.size(); ++i)
+        Py_XDECREF(removed[i]);
+}
+
+unsigned int attributeSlotsLayout(SbkObject* self)
+{
+    return self->d->attributeSlots ? self->d->attributeSlots->layout : 0;
 }
 
 void clearReferences(SbkObject* self)
 {
+    if (self->d->attributeSlots) {
+        std::vector<PyObject*> objects;
+        objects.swap(self->d->attributeSlots->objects);
+        for (std::size_t i = 0; i < objects.size(); ++i)
+            Py_XDECREF(objects[i]);
+    }
+
     if (!self->d->referredObjects)
         return;
 
-    RefCountMap& refCountMap = *(self->d->referredObjects);
-    RefCountMap::iterator iter;
-    for (iter = refCountMap.begin(); iter != refCountMap.end(); ++iter)
-        decRefPyObjectList(iter->second);
-    self->d->referredObjects->clear();
+    RefCountMap refCountMap;
+    refCountMap.swap(*(self->d->referredObjects));
+    for (RefCountMap::const_iterator it = refCountMap.begin(); it != refCountMap.end(); ++it)
+        Py_DECREF(it->object);
 }
 
 std::string info(SbkObject* self)
@@ -1548,15 +1942,9 @@ std::string info(SbkObject* self)
         for (; it != map.end(); ++it) {
             if (it != map.begin())
                 s << "                   ";
-            s << '"' << it->first << "\" => ";
-            std::list<PyObject*>::const_iterator j = it->second.begin();
-            for (; j != it->second.end(); ++j) {
-                Shiboken::AutoDecRef obj(PyObject_Str(*j));
-                s << String::toCString(obj) << ' ';
-            }
-            s << ' ';
+            Shiboken::AutoDecRef obj(PyObject_Str(it->object));
+            s << '"' << it->key << "\" => " << String::toCString(obj) << '\n';
         }
-        s << '\n';
     }
     return s.str();
 }
@@ -43,6 +43,8 @@
 #include "sbkpython.h"
 #include "shibokenmacros.h"
 
+#include <new>
+#include <type_traits>
 #include <vector>
 #include <string>
 
@@ -144,6 +146,9 @@ void callCppDestructor(void* cptr)
  */
 SBK_DEPRECATED(LIBSHIBOKEN_API bool importModule(const char* moduleName, PyTypeObject*** cppApiPtr));
 LIBSHIBOKEN_API void        setErrorAboutWrongArguments(PyObject* args, const char* funcName, const char** cppOverloads);
+/// Overload used by METH_FASTCALL wrappers, which receive their arguments as an array.
+LIBSHIBOKEN_API void        setErrorAboutWrongArguments(PyObject* const* args, Py_ssize_t nargs,
+                                                        const char* funcName, const char** cppOverloads);
 
 namespace ObjectType {
 
@@ -234,6 +239,66 @@ LIBSHIBOKEN_API void        setSubTypeInitHook(SbkObjectType* self, SubTypeInitH
 LIBSHIBOKEN_API void*       getTypeUserData(SbkObjectType* self);
 LIBSHIBOKEN_API void        setTypeUserData(SbkObjectType* self, void* userData, DeleteUserDataFunc d_func);
 
+/**
+ *  Keeps up to \p capacity deallocated wrappers of \p type and as many blocks of memory
+ *  of its C++ instances for reuse, like the free list of Python floats.
+ *  Wrappers of Python subclasses of \p type are not affected.
+ */
+LIBSHIBOKEN_API void        setFreeList(SbkObjectType* type, int capacity);
+
+/**
+ *  Returns memory for a C++ instance of \p type of \p size bytes, taken from the free list
+ *  of \p type if possible. The memory is compatible with the global operator new and delete.
+ */
+LIBSHIBOKEN_API void*       allocateCppObject(SbkObjectType* type, size_t size);
+
+/// Puts the \p memory of a destroyed C++ instance of \p type on its free list, or frees it.
+LIBSHIBOKEN_API void        releaseCppObject(SbkObjectType* type, void* memory);
+
+/**
+ *  Returns the offset at which a C++ instance aligned to \p alignment bytes
+ *  is stored inside a wrapper, the basic size of such a type is that offset
+ *  plus the size of the C++ class.
+ */
+LIBSHIBOKEN_API size_t      inlineStorageOffset(size_t alignment);
+
+/**
+ *  Lets the wrappers of \p type hold copies of their C++ instances in their own memory,
+ *  see Object::newObjectWithInlineStorage(). The basic size of \p type must have room for them.
+ *  \param inlineDtor   destroys an instance stored inside a wrapper without freeing its memory.
+ */
+LIBSHIBOKEN_API void        setInlineStorage(SbkObjectType* type, size_t alignment, ObjectDestructor inlineDtor);
+
+/**
+ *  Tells whether the C++ destructor of \p type is cheap enough to run with the GIL held,
+ *  which avoids the GIL hand-off around the destruction of small or trivially destructible
+ *  instances. By default the GIL is released while C++ destructors run.
+ */
+LIBSHIBOKEN_API void        setDestructorKeepsGil(SbkObjectType* type, bool keepsGil);
+
+/**
+ *  Lets the C++ instances of \p type owned by Python be destroyed some time after their
+ *  wrappers, in batches that release the GIL once, instead of releasing it for each of them.
+ *  Batches run when the interpreter handles pending calls, when they grow large, on
+ *  Object::runDeferredDestructors() and at exit.
+ */
+LIBSHIBOKEN_API void        setDeferredDestruction(SbkObjectType* type, bool deferred);
+
+}
+
+/// Destroys the class T allocated on \p cptr, keeping its memory on the free list of \p type.
+template<typename T>
+void callCppDestructor(void* cptr, SbkObjectType* type)
+{
+    reinterpret_cast<T*>(cptr)->~T();
+    ObjectType::releaseCppObject(type, cptr);
+}
+
+/// Destroys the class T constructed inside the memory of its wrapper on \p cptr.
+template<typename T>
+void callCppInlineDestructor(void* cptr)
+{
+    reinterpret_cast<T*>(cptr)->~T();
 }
 
 namespace Object {
@@ -280,6 +345,14 @@ LIBSHIBOKEN_API PyObject*   newObject(SbkObjectType* instanceType,
                                       bool isExactType = false,
                                       const char* typeName = 0);
 
+/**
+ *  Creates a wrapper of exactly \p instanceType owning a C++ object stored in its own memory.
+ *  The caller must construct the C++ object on \p storage before the wrapper is used,
+ *  since it is already registered with that address. \p instanceType must have been
+ *  set up with ObjectType::setInlineStorage().
+ */
+LIBSHIBOKEN_API PyObject*   newObjectWithInlineStorage(SbkObjectType* instanceType, void** storage);
+
 /**
  *  Changes the valid flag of a PyObject, invalid objects will raise an exception when someone tries to access it.
  */
@@ -305,6 +378,12 @@ LIBSHIBOKEN_API bool        wasCreatedByPython(SbkObject* pyObj);
  */
 LIBSHIBOKEN_API void        callCppDestructors(SbkObject* pyObj);
 
+/**
+ *  Runs the destructors of the C++ instances whose destruction was deferred,
+ *  see ObjectType::setDeferredDestruction(). Must be called with the GIL held.
+ */
+LIBSHIBOKEN_API void        runDeferredDestructors();
+
 /**
  *  Return true if the Python is responsible for deleting the underlying C++ object.
  */
@@ -441,6 +520,31 @@ LIBSHIBOKEN_API void        keepReference(SbkObject* self, const char* key, PyOb
  */
 LIBSHIBOKEN_API void        removeReference(SbkObject* self, const char* key, PyObject* referredObject);
 
+/**
+ *   Returns the object kept in a slot by setAttributeSlot(), or null if the slot is empty or
+ *   the objects were kept under another layout. Returns a borrowed reference.
+ *   \param self            the wrapper instance keeping the object.
+ *   \param layout          identifies the numbering of the slots.
+ *   \param index           the slot number.
+ */
+LIBSHIBOKEN_API PyObject*   getAttributeSlot(SbkObject* self, unsigned int layout, int index);
+
+/**
+ *   Keeps a reference to an object in a numbered slot of the wrapper, for caching attributes
+ *   without an instance dict. The objects kept under a previous layout are released.
+ *   All the kept objects are released together with the references added by keepReference.
+ *   \param self            the wrapper instance keeping the object.
+ *   \param layout          identifies the numbering of the slots.
+ *   \param index           the slot number.
+ *   \param object          the object to keep, may be null to empty the slot.
+ */
+LIBSHIBOKEN_API void        setAttributeSlot(SbkObject* self, unsigned int layout, int index, PyObject* object);
+
+/**
+ *   Returns the layout the attribute slots of the wrapper were last set under, 0 if none was set.
+ */
+LIBSHIBOKEN_API unsigned int attributeSlotsLayout(SbkObject* self);
+
 } // namespace Object
 
 } // namespace Shiboken
@@ -47,6 +47,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 struct SbkObject;
 struct SbkObjectType;
@@ -54,11 +55,30 @@ struct SbkConverter;
 
 namespace Shiboken
 {
+/// A reference kept by a wrapper object under the key of a method and argument.
+struct RefCountEntry
+{
+    /// Interned key, compared by address before comparing its characters.
+    const char* key;
+    PyObject* object;
+};
+
 /**
     * This mapping associates a method and argument of an wrapper object with the wrapper of
     * said argument when it needs the binding to help manage its reference count.
+    * It is a flat list with an entry per reference since wrappers keep few of them.
     */
-typedef std::map<std::string, std::list<PyObject*> > RefCountMap;
+typedef std::vector<RefCountEntry> RefCountMap;
+
+/// Objects a wrapper keeps in numbered slots, see Shiboken::Object::setAttributeSlot().
+struct AttributeSlots
+{
+    AttributeSlots() : layout(0) {}
+    /// Identifies the numbering the objects were kept under.
+    unsigned int layout;
+    /// The objects by slot, null for empty slots.
+    std::vector<PyObject*> objects;
+};
 
 /// Linked list of SbkBaseWrapper pointers
 typedef std::set<SbkObject*> ChildrenList;
@@ -101,6 +121,8 @@ struct SbkObjectPrivate
     Shiboken::ParentInfo* parentInfo;
     /// Manage reference count of objects that are referred to but not owned from.
     Shiboken::RefCountMap* referredObjects;
+    /// Attributes cached in numbered slots instead of the instance dict, may be null.
+    Shiboken::AttributeSlots* attributeSlots;
 
     ~SbkObjectPrivate()
     {
@@ -108,9 +130,24 @@ struct SbkObjectPrivate
         parentInfo = 0;
         delete referredObjects;
         referredObjects = 0;
+        delete attributeSlots;
+        attributeSlots = 0;
     }
 };
 
+/**
+ * Memory layout of the wrappers created by SbkObjectTpNew.
+ * The private data and, for types with a single C++ base, the C++ pointer
+ * live in the same allocation as the Python object, so creating a wrapper
+ * needs no extra heap allocations in the common case.
+ */
+struct SbkObjectStorage
+{
+    SbkObject object;
+    SbkObjectPrivate d;
+    void* cptr;
+};
+
 // TODO-CONVERTERS: to be deprecated/removed
 /// The type behaviour was not defined yet
 #define BEHAVIOUR_UNDEFINED 0
@@ -119,6 +156,23 @@ struct SbkObjectPrivate
 /// The type is an object type
 #define BEHAVIOUR_OBJECTTYPE 2
 
+/// Maps a class to the index of the C++ pointer that holds its instance.
+struct SbkCppBaseIndex
+{
+    PyTypeObject* type;
+    int index;
+};
+
+/// Deallocated wrappers and C++ instance memory of a type kept for reuse.
+struct SbkFreeList
+{
+    int capacity;
+    int wrapperCount;
+    int cppObjectCount;
+    PyObject** wrappers;
+    void** cppObjects;
+};
+
 struct SbkObjectTypePrivate
 {
     SbkConverter* converter;
@@ -143,6 +197,25 @@ struct SbkObjectTypePrivate
     void* user_data;
     DeleteUserDataFunc d_func;
     void (*subtype_init)(SbkObjectType*, PyObject*, PyObject*);
+    /// Maps interned virtual method names to Py_True if they are overridden in Python, Py_False otherwise.
+    PyObject* override_cache;
+    /// Value of the type modification counter when override_cache was last valid.
+    unsigned long override_cache_tag;
+    /// Number of C++ instances held by instances of a multi-C++ type, 0 otherwise.
+    int cpp_base_count;
+    /// Maps every class in the hierarchy of the C++ bases of a multi-C++ type to the
+    /// index of its C++ pointer, terminated by a null type. Null for other types.
+    SbkCppBaseIndex* cpp_base_indexes;
+    /// Free list of value types declared with one in the typesystem, null for other types.
+    SbkFreeList* freelist;
+    /// Offset of the C++ instance stored inside the wrappers of the type, 0 if it has no inline storage.
+    int inline_storage_offset;
+    /// Destructor of the C++ instance stored inside a wrapper, it does not free the memory.
+    ObjectDestructor inline_dtor;
+    /// True if the C++ destructor is cheap enough to run without releasing the GIL.
+    unsigned int dtor_keeps_gil : 1;
+    /// True if the C++ destructor runs later in a batch, see ObjectType::setDeferredDestruction().
+    unsigned int dtor_deferred : 1;
 };
 
 
@@ -267,6 +340,52 @@ inline std::list<SbkObjectType*> getCppBaseClasses(PyTypeObject* baseType)
     return visitor.bases();
 }
 
+namespace ObjectType
+{
+/**
+ *  Returns the override cache of \p type, discarding stale entries first.
+ *  The cache is invalidated whenever an attribute is set on any Shiboken
+ *  type, since that may add or remove a Python override in a subclass.
+ *  \returns   a borrowed dictionary, or null if the method resolution order of
+ *              \p type contains classes that can be modified without notice.
+ */
+PyObject* overrideCache(SbkObjectType* type);
+
+/**
+ *  Builds the table of C++ pointer indexes of a multi-C++ \p type, whose C++
+ *  base classes are \p bases, in the order of the C++ pointers.
+ */
+void initCppBaseIndexes(SbkObjectType* type, const std::list<SbkObjectType*>& bases);
+
+/// Returns the number of C++ instances held by instances of \p type.
+inline int cppPointerCount(PyTypeObject* type)
+{
+    const SbkObjectTypePrivate* sotp = PepType_SOTP(type);
+    return (sotp && sotp->is_multicpp) ? sotp->cpp_base_count : 1;
+}
+
+/// Returns the index of the C++ pointer of \p desiredType in instances of \p type.
+int cppPointerIndex(PyTypeObject* type, PyTypeObject* desiredType);
+
+/// Takes a wrapper of exactly \p type from its free list, returns null if there is none.
+SbkObject* takeFreeWrapper(PyTypeObject* type);
+
+/// Puts the memory of the deallocated \p wrapper on the free list of its type, if it has room.
+bool putFreeWrapper(SbkObject* wrapper);
+
+/// Frees the wrappers and the C++ instance memory kept on the free list of \p type.
+void clearFreeList(PyTypeObject* type);
+
+/// Returns the address of the C++ instance stored inside \p wrapper, null if its type has no inline storage.
+void* inlineStorage(SbkObject* wrapper);
+
+/**
+ *  Destroys the C++ instance \p cptr held by \p wrapper if it lives inside the wrapper.
+ *  \returns   false if \p cptr is allocated elsewhere and must be deleted by the caller.
+ */
+bool destroyInlineCppObject(SbkObject* wrapper, void* cptr);
+} // namespace ObjectType
+
 namespace Object
 {
 /**
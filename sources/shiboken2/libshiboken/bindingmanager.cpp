@@ -43,16 +43,187 @@
 #include "sbkdbg.h"
 #include "gilstate.h"
 #include "sbkstring.h"
+#include "autodecref.h"
 #include "debugfreehook.h"
+#include "sbkconverter.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+#ifdef Py_GIL_DISABLED
+#  include <mutex>
+#endif
 
 namespace Shiboken
 {
 
-typedef std::unordered_map<const void *, SbkObject *> WrapperMap;
+/**
+ *  Maps C++ instances to their wrappers.
+ *  Open addressing hash table with linear probing, split into shards selected
+ *  by the pointer hash so that each one can be locked on its own in builds
+ *  running without the GIL.
+ */
+class WrapperMap
+{
+public:
+    typedef std::pair<const void*, SbkObject*> Entry;
+
+    std::size_t size() const
+    {
+        std::size_t result = 0;
+        for (int i = 0; i < ShardCount; ++i) {
+            ShardLocker locker(m_shards[i]);
+            result += m_shards[i].count;
+        }
+        return result;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    SbkObject* find(const void* key) const
+    {
+        const std::uint64_t hash = hashPointer(key);
+        const Shard& shard = shardFor(hash);
+        ShardLocker locker(shard);
+        if (!shard.count)
+            return nullptr;
+        return shard.slots[shard.lookup(key, hash)].second;
+    }
+
+    /// Stores \p value for \p key unless \p key is already present; returns the value stored for \p key.
+    SbkObject* findOrInsert(const void* key, SbkObject* value)
+    {
+        assert(key);
+        const std::uint64_t hash = hashPointer(key);
+        Shard& shard = shardFor(hash);
+        ShardLocker locker(shard);
+        if ((shard.count + 1) * 10 > shard.capacity * 7)
+            shard.grow();
+        Entry& slot = shard.slots[shard.lookup(key, hash)];
+        if (!slot.first) {
+            slot = Entry(key, value);
+            ++shard.count;
+        }
+        return slot.second;
+    }
+
+    /// Removes \p key if it is mapped to \p value, or to anything when \p value is null.
+    bool erase(const void* key, SbkObject* value)
+    {
+        const std::uint64_t hash = hashPointer(key);
+        Shard& shard = shardFor(hash);
+        ShardLocker locker(shard);
+        if (!shard.count)
+            return false;
+        std::size_t index = shard.lookup(key, hash);
+        if (!shard.slots[index].first || (value && shard.slots[index].second != value))
+            return false;
+        // Backward shift deletion: move later entries of the probe sequence into the
+        // hole, which keeps lookups free of tombstones.
+        const std::size_t mask = shard.capacity - 1;
+        for (std::size_t next = (index + 1) & mask; shard.slots[next].first; next = (next + 1) & mask) {
+            const std::size_t home = homeIndex(hashPointer(shard.slots[next].first), mask);
+            if (((next - home) & mask) >= ((next - index) & mask)) {
+                shard.slots[index] = shard.slots[next];
+                index = next;
+            }
+        }
+        shard.slots[index] = Entry(nullptr, nullptr);
+        --shard.count;
+        return true;
+    }
+
+    /// Returns a snapshot of the map contents.
+    std::vector<Entry> entries() const
+    {
+        std::vector<Entry> result;
+        for (int i = 0; i < ShardCount; ++i) {
+            const Shard& shard = m_shards[i];
+            ShardLocker locker(shard);
+            for (std::size_t j = 0; j < shard.capacity; ++j) {
+                if (shard.slots[j].first)
+                    result.push_back(shard.slots[j]);
+            }
+        }
+        return result;
+    }
+
+private:
+    enum { ShardBits = 4, ShardCount = 1 << ShardBits, InitialCapacity = 64 };
+
+    struct Shard
+    {
+        Shard() : slots(nullptr), capacity(0), count(0) {}
+        ~Shard() { delete[] slots; }
+
+        // Returns the index of \p key, or of the empty slot where it would be inserted.
+        std::size_t lookup(const void* key, std::uint64_t hash) const
+        {
+            const std::size_t mask = capacity - 1;
+            std::size_t index = homeIndex(hash, mask);
+            while (slots[index].first && slots[index].first != key)
+                index = (index + 1) & mask;
+            return index;
+        }
+
+        void grow()
+        {
+            Entry* oldSlots = slots;
+            const std::size_t oldCapacity = capacity;
+            capacity = capacity ? capacity * 2 : std::size_t(InitialCapacity);
+            slots = new Entry[capacity];
+            for (std::size_t i = 0; i < oldCapacity; ++i) {
+                if (oldSlots[i].first)
+                    slots[lookup(oldSlots[i].first, hashPointer(oldSlots[i].first))] = oldSlots[i];
+            }
+            delete[] oldSlots;
+        }
+
+        Entry* slots;
+        std::size_t capacity;
+        std::size_t count;
+#ifdef Py_GIL_DISABLED
+        mutable std::mutex mutex;
+#endif
+    };
+
+    class ShardLocker
+    {
+    public:
+#ifdef Py_GIL_DISABLED
+        explicit ShardLocker(const Shard& shard) : m_lock(shard.mutex) {}
+    private:
+        std::lock_guard<std::mutex> m_lock;
+#else
+        explicit ShardLocker(const Shard&) {}
+#endif
+    };
+
+    // Pointers are aligned, so mix all bits (MurmurHash3 finalizer) before picking shard and slot.
+    static std::uint64_t hashPointer(const void* key)
+    {
+        std::uint64_t hash = std::uint64_t(reinterpret_cast<std::uintptr_t>(key));
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    static std::size_t homeIndex(std::uint64_t hash, std::size_t mask)
+    {
+        return std::size_t(hash >> ShardBits) & mask;
+    }
+
+    Shard& shardFor(std::uint64_t hash) { return m_shards[hash & (ShardCount - 1)]; }
+    const Shard& shardFor(std::uint64_t hash) const { return m_shards[hash & (ShardCount - 1)]; }
+
+    Shard m_shards[ShardCount];
+};
 
 class Graph
 {
@@ -128,8 +299,9 @@ static void showWrapperMap(const WrapperMap& wrapperMap)
     if (Py_VerboseFlag > 0) {
         fprintf(stderr, "-------------------------------\n");
         fprintf(stderr, "WrapperMap: %p (size: %d)\n", &wrapperMap, (int) wrapperMap.size());
-        WrapperMap::const_iterator iter;
-        for (iter = wrapperMap.begin(); iter != wrapperMap.end(); ++iter) {
+        const std::vector<WrapperMap::Entry> entries = wrapperMap.entries();
+        std::vector<WrapperMap::Entry>::const_iterator iter;
+        for (iter = entries.begin(); iter != entries.end(); ++iter) {
             const SbkObject *sbkObj = iter->second;
             fprintf(stderr, "key: %p, value: %p (%s, refcnt: %d)\n", iter->first,
                     static_cast<const void *>(sbkObj),
@@ -141,9 +313,25 @@ static void showWrapperMap(const WrapperMap& wrapperMap)
 }
 #endif
 
+typedef std::pair<SbkObjectType*, const char*> ResolvedTypeKey;
+
+struct ResolvedTypeKeyHash
+{
+    std::size_t operator()(const ResolvedTypeKey& key) const
+    {
+        const std::size_t h = std::hash<const void*>()(key.first);
+        return h ^ (std::hash<const void*>()(key.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+};
+
+// Wrapper types registered for a dynamic C++ type name, by static type and name.
+typedef std::unordered_map<ResolvedTypeKey, SbkObjectType*, ResolvedTypeKeyHash> ResolvedTypeCache;
+
 struct BindingManager::BindingManagerPrivate {
     WrapperMap wrapperMapper;
     Graph classHierarchy;
+    // Cleared whenever the class hierarchy changes.
+    ResolvedTypeCache resolvedTypes;
     bool destroying;
 
     BindingManagerPrivate() : destroying(false) {}
@@ -157,20 +345,13 @@ bool BindingManager::BindingManagerPrivate::releaseWrapper(void* cptr, SbkObject
     // The wrapper argument is checked to ensure that the correct wrapper is released.
     // Returns true if the correct wrapper is found and released.
     // If wrapper argument is NULL, no such check is performed.
-    WrapperMap::iterator iter = wrapperMapper.find(cptr);
-    if (iter != wrapperMapper.end() && (wrapper == 0 || iter->second == wrapper)) {
-        wrapperMapper.erase(iter);
-        return true;
-    }
-    return false;
+    return wrapperMapper.erase(cptr, wrapper);
 }
 
 void BindingManager::BindingManagerPrivate::assignWrapper(SbkObject* wrapper, const void* cptr)
 {
     assert(cptr);
-    WrapperMap::iterator iter = wrapperMapper.find(cptr);
-    if (iter == wrapperMapper.end())
-        wrapperMapper.insert(std::make_pair(cptr, wrapper));
+    wrapperMapper.findOrInsert(cptr, wrapper);
 }
 
 BindingManager::BindingManager()
@@ -195,7 +376,13 @@ BindingManager::~BindingManager()
      * shutting down. */
     if (Py_IsInitialized()) {  // ensure the interpreter is still valid
         while (!m_d->wrapperMapper.empty()) {
-            Object::destroy(m_d->wrapperMapper.begin()->second, const_cast<void*>(m_d->wrapperMapper.begin()->first));
+            const std::vector<WrapperMap::Entry> entries = m_d->wrapperMapper.entries();
+            std::vector<WrapperMap::Entry>::const_iterator it = entries.begin();
+            for (; it != entries.end(); ++it) {
+                // Destroying a wrapper releases all of its entries.
+                if (m_d->wrapperMapper.find(it->first) == it->second)
+                    Object::destroy(it->second, const_cast<void*>(it->first));
+            }
         }
         assert(m_d->wrapperMapper.size() == 0);
     }
@@ -209,7 +396,7 @@ BindingManager& BindingManager::instance() {
 
 bool BindingManager::hasWrapper(const void* cptr)
 {
-    return m_d->wrapperMapper.find(cptr) != m_d->wrapperMapper.end();
+    return m_d->wrapperMapper.find(cptr) != nullptr;
 }
 
 void BindingManager::registerWrapper(SbkObject* pyObj, void* cptr)
@@ -237,7 +424,7 @@ void BindingManager::releaseWrapper(SbkObject* sbkObj)
 {
     SbkObjectType* sbkType = reinterpret_cast<SbkObjectType*>(Py_TYPE(sbkObj));
     SbkObjectTypePrivate* d = PepType_SOTP(sbkType);
-    int numBases = ((d && d->is_multicpp) ? getNumberOfCppBaseClasses(Py_TYPE(sbkObj)) : 1);
+    int numBases = ObjectType::cppPointerCount(Py_TYPE(sbkObj));
 
     void** cptrs = reinterpret_cast<SbkObject*>(sbkObj)->d->cptr;
     for (int i = 0; i < numBases; ++i) {
@@ -257,29 +444,17 @@ void BindingManager::releaseWrapper(SbkObject* sbkObj)
 
 SbkObject* BindingManager::retrieveWrapper(const void* cptr)
 {
-    WrapperMap::iterator iter = m_d->wrapperMapper.find(cptr);
-    if (iter == m_d->wrapperMapper.end())
-        return 0;
-    return iter->second;
+    return m_d->wrapperMapper.find(cptr);
 }
 
 PyObject* BindingManager::getOverride(const void* cptr, const char* methodName)
 {
-    SbkObject* wrapper = retrieveWrapper(cptr);
-    // The refcount can be 0 if the object is dieing and someone called
-    // a virtual method from the destructor
-    if (!wrapper || reinterpret_cast<const PyObject *>(wrapper)->ob_refcnt == 0)
-        return 0;
-
-    if (wrapper->ob_dict) {
-        PyObject* method = PyDict_GetItemString(wrapper->ob_dict, methodName);
-        if (method) {
-            Py_INCREF(reinterpret_cast<PyObject *>(method));
-            return method;
-        }
-    }
+    Shiboken::AutoDecRef pyMethodName(Shiboken::String::fromCString(methodName));
+    return getOverride(cptr, pyMethodName);
+}
 
-    PyObject* pyMethodName = Shiboken::String::fromCString(methodName);
+static PyObject* findOverride(SbkObject* wrapper, PyObject* pyMethodName)
+{
     PyObject *method = PyObject_GetAttr(reinterpret_cast<PyObject *>(wrapper), pyMethodName);
 
     if (method && PyMethod_Check(method)
@@ -293,22 +468,53 @@ PyObject* BindingManager::getOverride(const void* cptr, const char* methodName)
             PyTypeObject* parent = reinterpret_cast<PyTypeObject*>(PyTuple_GET_ITEM(mro, i));
             if (parent->tp_dict) {
                 defaultMethod = PyDict_GetItem(parent->tp_dict, pyMethodName);
-                if (defaultMethod && PyMethod_GET_FUNCTION(method) != defaultMethod) {
-                    Py_DECREF(pyMethodName);
+                if (defaultMethod && PyMethod_GET_FUNCTION(method) != defaultMethod)
                     return method;
-                }
             }
         }
     }
 
     Py_XDECREF(method);
-    Py_DECREF(pyMethodName);
     return 0;
 }
 
+PyObject* BindingManager::getOverride(const void* cptr, PyObject* methodName)
+{
+    SbkObject* wrapper = retrieveWrapper(cptr);
+    // The refcount can be 0 if the object is dieing and someone called
+    // a virtual method from the destructor
+    if (!wrapper || reinterpret_cast<const PyObject *>(wrapper)->ob_refcnt == 0)
+        return 0;
+
+    if (wrapper->ob_dict) {
+        PyObject* method = PyDict_GetItem(wrapper->ob_dict, methodName);
+        if (method) {
+            Py_INCREF(reinterpret_cast<PyObject *>(method));
+            return method;
+        }
+    }
+
+    // Whether a type overrides a method does not depend on the instance,
+    // so the common "not overridden" answer is remembered per type.
+    PyObject* cache = ObjectType::overrideCache(reinterpret_cast<SbkObjectType*>(Py_TYPE(wrapper)));
+    if (cache) {
+        PyObject* cached = PyDict_GetItem(cache, methodName);
+        if (cached == Py_False)
+            return 0;
+        if (cached == Py_True)
+            return findOverride(wrapper, methodName);
+    }
+
+    PyObject* method = findOverride(wrapper, methodName);
+    if (cache && !PyErr_Occurred())
+        PyDict_SetItem(cache, methodName, method ? Py_True : Py_False);
+    return method;
+}
+
 void BindingManager::addClassInheritance(SbkObjectType* parent, SbkObjectType* child)
 {
     m_d->classHierarchy.addEdge(parent, child);
+    m_d->resolvedTypes.clear();
 }
 
 SbkObjectType* BindingManager::resolveType(void* cptr, SbkObjectType* type)
@@ -322,12 +528,30 @@ SbkObjectType* BindingManager::resolveType(void** cptr, SbkObjectType* type)
     return identifiedType ? identifiedType : type;
 }
 
+SbkObjectType* BindingManager::resolveType(void** cptr, SbkObjectType* type, const char* typeName)
+{
+    // The names returned by std::type_info::name() are unique per type, compare them by address.
+    const ResolvedTypeKey key(type, typeName);
+    ResolvedTypeCache::const_iterator it = m_d->resolvedTypes.find(key);
+    if (it != m_d->resolvedTypes.end())
+        return it->second;
+
+    SbkObjectType* resolved = reinterpret_cast<SbkObjectType*>(Conversions::getPythonTypeObject(typeName));
+    if (!resolved) {
+        // Type discovery functions may look at the instance, and the dynamic type name of
+        // a non-polymorphic class is its static one, so their results are not remembered.
+        return resolveType(cptr, type);
+    }
+    m_d->resolvedTypes.insert(std::make_pair(key, resolved));
+    return resolved;
+}
+
 std::set<PyObject*> BindingManager::getAllPyObjects()
 {
     std::set<PyObject*> pyObjects;
-    const WrapperMap& wrappersMap = m_d->wrapperMapper;
-    WrapperMap::const_iterator it = wrappersMap.begin();
-    for (; it != wrappersMap.end(); ++it)
+    const std::vector<WrapperMap::Entry> entries = m_d->wrapperMapper.entries();
+    std::vector<WrapperMap::Entry>::const_iterator it = entries.begin();
+    for (; it != entries.end(); ++it)
         pyObjects.insert(reinterpret_cast<PyObject*>(it->second));
 
     return pyObjects;
@@ -335,8 +559,8 @@ std::set<PyObject*> BindingManager::getAllPyObjects()
 
 void BindingManager::visitAllPyObjects(ObjectVisitor visitor, void* data)
 {
-    WrapperMap copy = m_d->wrapperMapper;
-    for (WrapperMap::iterator it = copy.begin(); it != copy.end(); ++it) {
+    const std::vector<WrapperMap::Entry> copy = m_d->wrapperMapper.entries();
+    for (std::vector<WrapperMap::Entry>::const_iterator it = copy.begin(); it != copy.end(); ++it) {
         if (hasWrapper(it->first))
             visitor(it->second, data);
     }
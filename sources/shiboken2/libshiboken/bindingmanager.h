@@ -64,6 +64,12 @@ public:
 
     SbkObject* retrieveWrapper(const void* cptr);
     PyObject* getOverride(const void* cptr, const char* methodName);
+    /**
+     * Returns the Python method overriding the virtual method \p methodName of the
+     * wrapper for \p cptr, or null if it is not overridden.
+     * \param methodName an interned string, see Shiboken::String::createStaticString.
+     */
+    PyObject* getOverride(const void* cptr, PyObject* methodName);
 
     void addClassInheritance(SbkObjectType* parent, SbkObjectType* child);
     /**
@@ -80,6 +86,14 @@ public:
      * \warning This function is slow, use it only as last resort.
      */
     SbkObjectType* resolveType(void** cptr, SbkObjectType* type);
+    /**
+     * Finds the correct type of *cptr like \fn resolveType(void**, SbkObjectType*), starting with
+     * the wrapper type registered for \p typeName. That type is remembered for the pair of
+     * \p type and \p typeName, so later objects of the same dynamic C++ type skip the lookup.
+     * Types found by the type discovery functions depend on the instance and are not remembered.
+     * \param typeName the name of the dynamic C++ type of *cptr, as returned by std::type_info::name().
+     */
+    SbkObjectType* resolveType(void** cptr, SbkObjectType* type, const char* typeName);
 
     std::set<PyObject*> getAllPyObjects();
 
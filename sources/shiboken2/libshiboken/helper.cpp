@@ -115,6 +115,37 @@ int* sequenceToIntArray(PyObject* obj, bool zeroTerminated)
 }
 
 
+bool unpackFastCallArguments(PyObject* const* args, Py_ssize_t nargs, const char* funcName,
+                             Py_ssize_t minArgs, Py_ssize_t maxArgs, PyObject** pyArgs)
+{
+    if (nargs < minArgs || nargs > maxArgs) {
+        const bool tooFew = nargs < minArgs;
+        const Py_ssize_t expected = tooFew ? minArgs : maxArgs;
+        PyErr_Format(PyExc_TypeError, "%s expected %s%zd argument%s, got %zd", funcName,
+                     minArgs == maxArgs ? "" : (tooFew ? "at least " : "at most "),
+                     expected, expected == 1 ? "" : "s", nargs);
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < nargs; ++i)
+        pyArgs[i] = args[i];
+    return true;
+}
+
+PyObject* fastCallKeywordValue(PyObject* const* kwvalues, PyObject* kwnames, PyObject* name)
+{
+    const Py_ssize_t count = PyTuple_GET_SIZE(kwnames);
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        if (PyTuple_GET_ITEM(kwnames, i) == name)
+            return kwvalues[i];
+    }
+    // Keyword names are usually interned by the compiler, but not when built at run time.
+    for (Py_ssize_t i = 0; i < count; ++i) {
+        if (PyObject_RichCompareBool(PyTuple_GET_ITEM(kwnames, i), name, Py_EQ) == 1)
+            return kwvalues[i];
+    }
+    return 0;
+}
+
 int warning(PyObject* category, int stacklevel, const char* format, ...)
 {
     va_list args;
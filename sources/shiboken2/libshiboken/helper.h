@@ -85,6 +85,21 @@ class AutoArrayPointer
         T* data;
 };
 
+/**
+ * Copies the positional arguments of a METH_FASTCALL call into \p pyArgs, which must have room
+ * for \p maxArgs items. Missing arguments are left untouched.
+ * \returns false and sets a Python TypeError if \p nargs is not between \p minArgs and \p maxArgs.
+ */
+LIBSHIBOKEN_API bool unpackFastCallArguments(PyObject* const* args, Py_ssize_t nargs, const char* funcName,
+                                             Py_ssize_t minArgs, Py_ssize_t maxArgs, PyObject** pyArgs);
+
+/**
+ * Returns the value passed for the keyword \p name in a METH_FASTCALL call, or null if absent.
+ * \param kwvalues the values following the positional arguments, i.e. args + nargs.
+ * \param name an interned string, so that the usual match is a pointer comparison.
+ */
+LIBSHIBOKEN_API PyObject* fastCallKeywordValue(PyObject* const* kwvalues, PyObject* kwnames, PyObject* name);
+
 /**
  * An utility function used to call PyErr_WarnEx with a formatted message.
  */
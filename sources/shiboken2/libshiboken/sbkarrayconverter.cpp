@@ -47,8 +47,10 @@
 #include <floatobject.h>
 
 #include <algorithm>
+#include <cstring>
 
-static SbkArrayConverter *ArrayTypeConverters[Shiboken::Conversions::SBK_ARRAY_IDX_SIZE] [2] = {};
+static SbkArrayConverter *ArrayTypeConverters[Shiboken::Conversions::SBK_ARRAY_IDX_SIZE] [Shiboken::Conversions::SBK_ARRAY_MAX_DIMENSION] = {};
+static SbkArrayConverter *WritableArrayTypeConverters[Shiboken::Conversions::SBK_ARRAY_IDX_SIZE] [Shiboken::Conversions::SBK_ARRAY_MAX_DIMENSION] = {};
 
 namespace Shiboken {
 namespace Conversions {
@@ -244,12 +246,16 @@ static PythonToCppFunc sequenceToCppDoubleArrayCheck(PyObject *pyIn, int dim1, i
 
 #ifdef HAVE_NUMPY
 void initNumPyArrayConverters();
+Py_ssize_t numPyDoubleMatrixRowCount(PyObject *pyIn, int columns);
+bool copyNumPyDoubleMatrix(PyObject *pyIn, double *data);
 #endif
 
 void initArrayConverters()
 {
     SbkArrayConverter **start = &ArrayTypeConverters[0][0];
     std::fill(start, start + sizeof(ArrayTypeConverters) / sizeof(ArrayTypeConverters[0][0]), nullptr);
+    SbkArrayConverter **writableStart = &WritableArrayTypeConverters[0][0];
+    std::fill(writableStart, writableStart + sizeof(WritableArrayTypeConverters) / sizeof(WritableArrayTypeConverters[0][0]), nullptr);
     // Populate 1-dimensional sequence converters
     ArrayTypeConverters[SBK_DOUBLE_ARRAY_IDX][0] =
         createArrayConverter(sequenceToCppDoubleArrayCheck);
@@ -267,6 +273,11 @@ void initArrayConverters()
         createArrayConverter(sequenceToCppLongLongArrayCheck);
     ArrayTypeConverters[SBK_UNSIGNEDLONGLONG_ARRAY_IDX][0] =
         createArrayConverter(sequenceToCppUnsignedLongLongArrayCheck);
+    // Sequences are copied for arrays the C++ function writes to as well; the writes are lost.
+    for (int i = 0; i < SBK_ARRAY_IDX_SIZE; ++i) {
+        if (const SbkArrayConverter *c = ArrayTypeConverters[i][0])
+            WritableArrayTypeConverters[i][0] = new SbkArrayConverter(*c);
+    }
 
 #ifdef HAVE_NUMPY
     initNumPyArrayConverters();
@@ -275,15 +286,98 @@ void initArrayConverters()
 
 SbkArrayConverter *arrayTypeConverter(int index, int dimension)
 {
+    if (dimension < 1 || dimension > SBK_ARRAY_MAX_DIMENSION)
+        return unimplementedArrayConverter();
     SbkArrayConverter *c = ArrayTypeConverters[index][dimension - 1];
     return c ? c : unimplementedArrayConverter();
 }
 
+SbkArrayConverter *writableArrayTypeConverter(int index, int dimension)
+{
+    if (dimension < 1 || dimension > SBK_ARRAY_MAX_DIMENSION)
+        return unimplementedArrayConverter();
+    SbkArrayConverter *c = WritableArrayTypeConverters[index][dimension - 1];
+    return c ? c : unimplementedArrayConverter();
+}
+
+#ifndef Py_LIMITED_API
+// Obtains a (rows, columns) buffer of native doubles from pyIn, if it exports one.
+static bool getDoubleMatrixBuffer(PyObject *pyIn, int columns, Py_buffer *view)
+{
+    if (!PyObject_CheckBuffer(pyIn))
+        return false;
+    if (PyObject_GetBuffer(pyIn, view, PyBUF_RECORDS_RO) != 0) {
+        PyErr_Clear();
+        return false;
+    }
+    const char *format = view->format ? view->format : "B";
+    if (format[0] == '@' || format[0] == '=')
+        ++format;
+    if (view->ndim == 2 && view->shape[1] == columns && std::strcmp(format, "d") == 0)
+        return true;
+    PyBuffer_Release(view);
+    return false;
+}
+#endif // !Py_LIMITED_API
+
+Py_ssize_t doubleMatrixRowCount(PyObject *pyIn, int columns)
+{
+#ifdef HAVE_NUMPY
+    const Py_ssize_t numPyRows = numPyDoubleMatrixRowCount(pyIn, columns);
+    if (numPyRows != -2)
+        return numPyRows;
+#endif
+#ifndef Py_LIMITED_API
+    Py_buffer view;
+    if (getDoubleMatrixBuffer(pyIn, columns, &view)) {
+        const Py_ssize_t rows = view.shape[0];
+        PyBuffer_Release(&view);
+        return rows;
+    }
+#endif
+    return -1;
+}
+
+bool copyDoubleMatrix(PyObject *pyIn, int columns, double *data, Py_ssize_t rows)
+{
+#ifdef HAVE_NUMPY
+    if (numPyDoubleMatrixRowCount(pyIn, columns) == rows)
+        return copyNumPyDoubleMatrix(pyIn, data);
+#endif
+#ifndef Py_LIMITED_API
+    Py_buffer view;
+    if (!getDoubleMatrixBuffer(pyIn, columns, &view))
+        return false;
+    const bool result = view.shape[0] == rows;
+    if (result) {
+        if (PyBuffer_IsContiguous(&view, 'C')) {
+            std::memcpy(data, view.buf, size_t(rows) * size_t(columns) * sizeof(double));
+        } else {
+            const char *row = static_cast<const char *>(view.buf);
+            for (Py_ssize_t r = 0; r < rows; ++r, row += view.strides[0]) {
+                for (int c = 0; c < columns; ++c)
+                    std::memcpy(data++, row + c * view.strides[1], sizeof(double));
+            }
+        }
+    }
+    PyBuffer_Release(&view);
+    return result;
+#else
+    return false;
+#endif
+}
+
 // Internal, for usage by numpy
 void setArrayTypeConverter(int index, int dimension, SbkArrayConverter *c)
 {
     ArrayTypeConverters[index][dimension - 1] = c;
 }
 
+// Internal, for usage by numpy
+void setWritableArrayTypeConverter(int index, int dimension, SbkArrayConverter *c)
+{
+    WritableArrayTypeConverters[index][dimension - 1] = c;
+}
+
 } // namespace Conversions
 } // namespace Shiboken
@@ -41,8 +41,11 @@
 #define SBKARRAYCONVERTERS_H
 
 #include "sbkpython.h"
+#include "sbkconverter.h"
 #include "shibokenmacros.h"
 
+#include <type_traits>
+
 extern "C" {
 struct SbkArrayConverter;
 }
@@ -63,6 +66,9 @@ enum : int {
     SBK_ARRAY_IDX_SIZE
 };
 
+/// Highest number of dimensions of C++ arrays handled by the array converters.
+enum : int { SBK_ARRAY_MAX_DIMENSION = 4 };
+
 /**
  * ArrayHandle is the type expected by shiboken2's array converter
  * functions. It provides access to array data which it may own
@@ -94,31 +100,77 @@ private:
     bool m_owned = false;
 };
 
+template <class T, int... dims>
+struct ArrayRow;
+
+template <class T>
+struct ArrayRow<T>
+{
+    typedef T Type;
+};
+
+template <class T, int dim, int... dims>
+struct ArrayRow<T, dim, dims...>
+{
+    typedef typename ArrayRow<T, dims...>::Type Type[dim];
+};
+
 /**
- * Similar to ArrayHandle for fixed size 2 dimensional arrays.
- * columns is the size of the last dimension
- * It only has a setData() methods since it will be used for numpy only.
+ * Similar to ArrayHandle for fixed size N dimensional arrays.
+ * trailingDims are the sizes of all but the first dimension.
+ * It points to the data of a numpy array or owns a C-contiguous copy
+ * of it, for example when the array is strided or needs a type conversion.
  */
 
-template <class T, int columns>
-class Array2Handle
+template <class T, int... trailingDims>
+class ArrayNHandle
 {
+    ArrayNHandle(const ArrayNHandle &) = delete;
+    ArrayNHandle& operator=(const ArrayNHandle &) = delete;
 public:
-    typedef T RowType[columns];
+    typedef typename ArrayRow<T, trailingDims...>::Type RowType;
 
-    Array2Handle() {}
+    ArrayNHandle() {}
+    ~ArrayNHandle() { destroy(); }
 
     operator RowType*() const { return m_rows; }
 
-    void setData(RowType *d) { m_rows = d; }
+    void allocate(Py_ssize_t elementCount);
+    void setData(RowType *d);
 
 private:
-   RowType *m_rows = nullptr;
+    void destroy();
+
+    RowType *m_rows = nullptr;
+    bool m_owned = false;
 };
 
+/// Fixed size 2 dimensional arrays, columns is the size of the last dimension.
+template <class T, int columns>
+using Array2Handle = ArrayNHandle<T, columns>;
+
 /// Returns the converter for an array type.
 LIBSHIBOKEN_API SbkArrayConverter *arrayTypeConverter(int index, int dimension = 1);
 
+/**
+ *  Returns the converter for an array type whose elements the C++ function may write to
+ *  (non-const pointers). Unlike arrayTypeConverter(), it does not accept numpy arrays
+ *  that would need to be copied, since the writes would not reach them.
+ */
+LIBSHIBOKEN_API SbkArrayConverter *writableArrayTypeConverter(int index, int dimension = 1);
+
+/**
+ *  Returns the number of rows of \p pyIn if it is a numpy array or a buffer of shape
+ *  (rows, \p columns) whose elements can be converted to double, -1 otherwise.
+ */
+LIBSHIBOKEN_API Py_ssize_t doubleMatrixRowCount(PyObject *pyIn, int columns);
+
+/**
+ *  Copies the elements of \p pyIn, for which doubleMatrixRowCount() returned \p rows,
+ *  row by row into \p data.
+ */
+LIBSHIBOKEN_API bool copyDoubleMatrix(PyObject *pyIn, int columns, double *data, Py_ssize_t rows);
+
 template <class T>
 struct ArrayTypeIndex{
     enum : int { index = SBK_UNIMPLEMENTED_ARRAY_IDX };
@@ -136,6 +188,9 @@ template <> struct ArrayTypeIndex<unsigned long long> { enum : int { index = SBK
 template<typename T> SbkArrayConverter *ArrayTypeConverter(int dimension)
 { return arrayTypeConverter(ArrayTypeIndex<T>::index, dimension); }
 
+template<typename T> SbkArrayConverter *WritableArrayTypeConverter(int dimension)
+{ return writableArrayTypeConverter(ArrayTypeIndex<T>::index, dimension); }
+
 // ArrayHandle methods
 template<class T>
 void ArrayHandle<T>::allocate(Py_ssize_t size)
@@ -165,6 +220,74 @@ void ArrayHandle<T>::destroy()
     m_owned = false;
 }
 
+// ArrayNHandle methods
+template <class T, int... trailingDims>
+void ArrayNHandle<T, trailingDims...>::allocate(Py_ssize_t elementCount)
+{
+    destroy();
+    m_rows = reinterpret_cast<RowType *>(new T[elementCount]);
+    m_owned = true;
+}
+
+template <class T, int... trailingDims>
+void ArrayNHandle<T, trailingDims...>::setData(RowType *d)
+{
+    destroy();
+    m_rows = d;
+}
+
+template <class T, int... trailingDims>
+void ArrayNHandle<T, trailingDims...>::destroy()
+{
+    if (m_owned)
+        delete [] reinterpret_cast<T *>(m_rows);
+    m_rows = nullptr;
+    m_owned = false;
+}
+
+namespace Internal {
+
+template <class Container>
+inline bool packedSequenceToCpp(PyObject *, Container &, std::false_type)
+{
+    return false;
+}
+
+template <class Container>
+bool packedSequenceToCpp(PyObject *pyIn, Container &container, std::true_type)
+{
+    typedef typename Container::value_type T;
+    const int columns = packedDoubleColumns(SbkType<T>());
+    if (columns <= 0 || sizeof(T) != size_t(columns) * sizeof(double))
+        return false;
+    const Py_ssize_t rows = doubleMatrixRowCount(pyIn, columns);
+    if (rows < 0)
+        return false;
+    container.resize(rows);
+    if (rows > 0 && !copyDoubleMatrix(pyIn, columns, reinterpret_cast<double *>(container.data()), rows)) {
+        container.clear();
+        return false;
+    }
+    return true;
+}
+
+} // namespace Internal
+
+/**
+ *  Fills the contiguous \p container from \p pyIn in one go if its value type was
+ *  registered with setPackedDoubleLayout() and \p pyIn is a matching numpy array or
+ *  buffer, see doubleMatrixRowCount().
+ *  \returns false if \p pyIn has to be converted item by item.
+ */
+template <class Container>
+inline bool packedSequenceToCpp(PyObject *pyIn, Container &container)
+{
+    typedef typename Container::value_type T;
+    return Internal::packedSequenceToCpp(pyIn, container,
+                                         std::integral_constant<bool, std::is_standard_layout<T>::value
+                                                                      && std::is_default_constructible<T>::value>());
+}
+
 } // namespace Conversions
 } // namespace Shiboken
 
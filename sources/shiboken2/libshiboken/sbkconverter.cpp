@@ -39,6 +39,7 @@
 
 #include "sbkconverter.h"
 #include "sbkconverter_p.h"
+#include "sbkarrayconverter.h"
 #include "sbkarrayconverter_p.h"
 #include "basewrapper_p.h"
 #include "bindingmanager.h"
@@ -121,6 +122,7 @@ SbkConverter *createConverterObject(PyTypeObject *type,
     if (toCppPointerCheckFunc && toCppPointerConvFunc)
         converter->toCppPointerConversion = std::make_pair(toCppPointerCheckFunc, toCppPointerConvFunc);
     converter->toCppConversions.clear();
+    converter->packedDoubleColumns = 0;
 
     return converter;
 }
@@ -391,14 +393,15 @@ bool checkSequenceTypes(PyTypeObject* type, PyObject* pyIn)
 {
     assert(type);
     assert(pyIn);
-    if (PySequence_Size(pyIn) < 0) {
-        // clear the error if < 0 which means no length at all
+    if (!PySequence_Check(pyIn))
+        return false;
+    const FastSequence seq(pyIn);
+    if (!seq.isValid()) {
         PyErr_Clear();
         return false;
     }
-    const Py_ssize_t size = PySequence_Size(pyIn);
-    for (Py_ssize_t i = 0; i < size; ++i) {
-        if (!PyObject_TypeCheck(AutoDecRef(PySequence_GetItem(pyIn, i)), type))
+    for (Py_ssize_t i = 0, size = seq.size(); i < size; ++i) {
+        if (!PyObject_TypeCheck(seq[i], type))
             return false;
     }
     return true;
@@ -409,9 +412,13 @@ bool convertibleSequenceTypes(const SbkConverter *converter, PyObject *pyIn)
     assert(pyIn);
     if (!PySequence_Check(pyIn))
         return false;
-    const Py_ssize_t size = PySequence_Size(pyIn);
-    for (Py_ssize_t i = 0; i < size; ++i) {
-        if (!isPythonToCppConvertible(converter, AutoDecRef(PySequence_GetItem(pyIn, i))))
+    const FastSequence seq(pyIn);
+    if (!seq.isValid()) {
+        PyErr_Clear();
+        return false;
+    }
+    for (Py_ssize_t i = 0, size = seq.size(); i < size; ++i) {
+        if (!isPythonToCppConvertible(converter, seq[i]))
             return false;
     }
     return true;
@@ -421,6 +428,28 @@ bool convertibleSequenceTypes(SbkObjectType *type, PyObject *pyIn)
     assert(type);
     return convertibleSequenceTypes(PepType_SOTP(type)->converter, pyIn);
 }
+bool convertibleContiguousSequenceTypes(SbkObjectType *type, PyObject *pyIn)
+{
+    assert(type);
+    const SbkConverter *converter = PepType_SOTP(type)->converter;
+    if (converter->packedDoubleColumns > 0 && doubleMatrixRowCount(pyIn, converter->packedDoubleColumns) >= 0)
+        return true;
+    return convertibleSequenceTypes(converter, pyIn);
+}
+
+void setPackedDoubleLayout(SbkObjectType *type, int columns)
+{
+    assert(type);
+    PepType_SOTP(type)->converter->packedDoubleColumns = columns;
+}
+
+int packedDoubleColumns(PyTypeObject *type)
+{
+    if (!type || !ObjectType::checkType(type))
+        return 0;
+    const SbkConverter *converter = PepType_SOTP(type)->converter;
+    return converter ? converter->packedDoubleColumns : 0;
+}
 
 bool checkPairTypes(PyTypeObject* firstType, PyTypeObject* secondType, PyObject* pyIn)
 {
@@ -45,6 +45,7 @@
 
 #include <limits>
 #include <string>
+#include <type_traits>
 
 struct SbkObject;
 struct SbkObjectType;
@@ -291,6 +292,24 @@ LIBSHIBOKEN_API bool convertibleSequenceTypes(const SbkConverter *converter, PyO
 /// Returns true if a Python sequence is comprised of objects of a type convertible to \p type.
 LIBSHIBOKEN_API bool convertibleSequenceTypes(SbkObjectType *type, PyObject *pyIn);
 
+/**
+ *  Like convertibleSequenceTypes(), for contiguous containers like QVector, which are
+ *  filled with packedSequenceToCpp(). They also accept numpy arrays or buffers of the
+ *  shape declared by setPackedDoubleLayout().
+ */
+LIBSHIBOKEN_API bool convertibleContiguousSequenceTypes(SbkObjectType *type, PyObject *pyIn);
+
+/**
+ *  Declares that instances of the wrapped value \p type consist of \p columns doubles and
+ *  nothing else, like a point or a rectangle. Contiguous sequences of \p type may then also
+ *  be given as numpy arrays or buffers of shape (rows, columns), which are copied in one go,
+ *  see convertibleContiguousSequenceTypes().
+ */
+LIBSHIBOKEN_API void setPackedDoubleLayout(SbkObjectType *type, int columns);
+
+/// Returns the number of doubles declared by setPackedDoubleLayout() for \p type, or 0.
+LIBSHIBOKEN_API int packedDoubleColumns(PyTypeObject *type);
+
 /// Returns true if a Python sequence can be converted to a C++ pair.
 LIBSHIBOKEN_API bool checkPairTypes(PyTypeObject* firstType, PyTypeObject* secondType, PyObject* pyIn);
 
@@ -361,6 +380,147 @@ template<> inline SbkConverter* PrimitiveTypeConverter<unsigned long>() { return
 template<> inline SbkConverter* PrimitiveTypeConverter<unsigned short>() { return primitiveTypeConverter(SBK_UNSIGNEDSHORT_IDX); }
 template<> inline SbkConverter* PrimitiveTypeConverter<void*>() { return primitiveTypeConverter(SBK_VOIDPTR_IDX); }
 
+/**
+ *  Random access to the items of a Python sequence for the container conversions.
+ *  Lists and tuples are read in place, other sequences are copied once into a list.
+ *  The items are borrowed references, valid as long as the FastSequence lives.
+ */
+class FastSequence
+{
+public:
+    explicit FastSequence(PyObject* pyIn)
+        : m_seq(PySequence_Fast(pyIn, "A sequence is expected.")),
+          m_size(m_seq ? PySequence_Fast_GET_SIZE(m_seq) : 0) {}
+    ~FastSequence() { Py_XDECREF(m_seq); }
+
+    bool isValid() const { return m_seq != 0; }
+    Py_ssize_t size() const { return m_size; }
+    PyObject* operator[](Py_ssize_t i) const { return PySequence_Fast_GET_ITEM(m_seq, i); }
+
+    FastSequence(const FastSequence&) = delete;
+    FastSequence& operator=(const FastSequence&) = delete;
+
+private:
+    PyObject* m_seq;
+    Py_ssize_t m_size;
+};
+
+/**
+ *  Direct conversion of a Python object to a C++ value, used by fastSequenceToCpp() for
+ *  the element types of containers that are commonly passed in bulk. It handles only the
+ *  exact Python types of the value and returns false for everything else, leaving the
+ *  item to the regular converter. Types without a specialization are never converted.
+ */
+template <typename T>
+struct FastItemConverter
+{
+    enum { Enabled = 0 };
+    static bool toCpp(PyObject*, T*) { return false; }
+};
+
+template <>
+struct FastItemConverter<int>
+{
+    enum { Enabled = 1 };
+    static bool toCpp(PyObject* pyIn, int* cppOut)
+    {
+        if (!PyInt_CheckExact(pyIn))
+            return false;
+        const long value = PyInt_AsLong(pyIn);
+        if (value == -1 && PyErr_Occurred()) {
+            PyErr_Clear();
+            return false;
+        }
+        if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+            return false;
+        *cppOut = int(value);
+        return true;
+    }
+};
+
+template <>
+struct FastItemConverter<double>
+{
+    enum { Enabled = 1 };
+    static bool toCpp(PyObject* pyIn, double* cppOut)
+    {
+        if (PyFloat_CheckExact(pyIn)) {
+            *cppOut = PyFloat_AS_DOUBLE(pyIn);
+            return true;
+        }
+        if (!PyInt_CheckExact(pyIn))
+            return false;
+        const double value = PyLong_AsDouble(pyIn);
+        if (value == -1.0 && PyErr_Occurred()) {
+            PyErr_Clear();
+            return false;
+        }
+        *cppOut = value;
+        return true;
+    }
+};
+
+namespace Internal
+{
+template <typename Container>
+inline auto reserveItems(Container& container, Py_ssize_t size, int) -> decltype(container.reserve(size), void())
+{
+    container.reserve(size);
+}
+
+template <typename Container>
+inline void reserveItems(Container&, Py_ssize_t, long) {}
+
+template <typename Container, typename T>
+inline auto appendItem(Container& container, const T& item, int) -> decltype(container.push_back(item), void())
+{
+    container.push_back(item);
+}
+
+template <typename Container, typename T>
+inline void appendItem(Container& container, const T& item, long)
+{
+    container.insert(item);
+}
+
+template <typename Container>
+inline Py_ssize_t fastSequenceToCpp(const FastSequence&, Container&, std::false_type)
+{
+    return 0;
+}
+
+template <typename Container>
+inline Py_ssize_t fastSequenceToCpp(const FastSequence& seq, Container& container, std::true_type)
+{
+    typedef typename Container::value_type T;
+    T item;
+    Py_ssize_t i = 0;
+    for (const Py_ssize_t size = seq.size(); i < size && FastItemConverter<T>::toCpp(seq[i], &item); ++i)
+        appendItem(container, item, 0);
+    return i;
+}
+} // namespace Internal
+
+/// Reserves space for \p size items in \p container, if the container supports it.
+template <typename Container>
+inline void reserveItems(Container& container, Py_ssize_t size)
+{
+    Internal::reserveItems(container, size, 0);
+}
+
+/**
+ *  Appends the leading items of \p seq that have a direct conversion to the element type
+ *  of \p container, see FastItemConverter.
+ *  \returns the number of items converted; the caller converts the remaining ones.
+ */
+template <typename Container>
+inline Py_ssize_t fastSequenceToCpp(const FastSequence& seq, Container& container)
+{
+    typedef typename Container::value_type T;
+    return Internal::fastSequenceToCpp(seq, container,
+                                       std::integral_constant<bool, FastItemConverter<T>::Enabled != 0>());
+}
+
 } // namespace Shiboken::Conversions
 
 /**
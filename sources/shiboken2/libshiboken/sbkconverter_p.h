@@ -105,6 +105,12 @@ struct SbkConverter
      *  list is always empty.
      */
     ToCppConversionList     toCppConversions;
+    /**
+     *  Number of doubles an instance of the C++ type consists of, if it has
+     *  no other data, like a point or a rectangle; 0 otherwise.
+     *  Sequences of such types may be given as (rows, columns) arrays.
+     */
+    int                     packedDoubleColumns;
 };
 
 } // extern "C"
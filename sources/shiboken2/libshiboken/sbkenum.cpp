@@ -48,9 +48,27 @@
 #include <string.h>
 #include <cstring>
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 #define SBK_ENUM(ENUM) reinterpret_cast<SbkEnumObject*>(ENUM)
 
+namespace Shiboken
+{
+
+/// An item borrowed from the "values" dict of an enum type, together with its key there.
+struct EnumValueEntry
+{
+    PyObject* item;
+    std::string name;
+};
+
+/// Maps the values of an enum type to their first named item.
+typedef std::unordered_map<long, EnumValueEntry> EnumValueIndex;
+
+} // namespace Shiboken
+
 extern "C"
 {
 
@@ -59,8 +77,14 @@ struct SbkEnumTypePrivate
     SbkConverter** converterPtr;
     SbkConverter* converter;
     const char* cppName;
+    Shiboken::EnumValueIndex* valueIndex;
 };
 
+// The private data of enum types created by newTypeWithName() lives in the space
+// PyType_FromSpec() allocates for the sentinel of the (empty) member table.
+static_assert(sizeof(SbkEnumTypePrivate) <= sizeof(PyMemberDef),
+              "SbkEnumTypePrivate does not fit into the space reserved for it");
+
 struct SbkEnumType
 {
     PyTypeObject type;
@@ -318,6 +342,8 @@ void SbkEnumTypeDealloc(PyObject* pyObj)
     if (PepType_SETP(sbkType)->converter) {
         Shiboken::Conversions::deleteConverter(PepType_SETP(sbkType)->converter);
     }
+    delete PepType_SETP(sbkType)->valueIndex;
+    PepType_SETP(sbkType)->valueIndex = nullptr;
 #ifndef Py_LIMITED_API
     Py_TRASHCAN_SAFE_END(pyObj);
 #endif
@@ -357,16 +383,41 @@ bool check(PyObject* pyObj)
     return Py_TYPE(Py_TYPE(pyObj)) == SbkEnumType_TypeF();
 }
 
+static inline bool isEnumItem(PyTypeObject* enumType, PyObject* item, long itemValue)
+{
+    return item && Py_TYPE(item) == enumType && SBK_ENUM(item)->ob_value == itemValue;
+}
+
 PyObject* getEnumItemFromValue(PyTypeObject* enumType, long itemValue)
 {
+    PyObject* values = PyDict_GetItemString(enumType->tp_dict, const_cast<char*>("values"));
+    if (!values)
+        return 0;
+    EnumValueIndex* index = PepType_SETP(reinterpret_cast<SbkEnumType*>(enumType))->valueIndex;
+    if (index) {
+        EnumValueIndex::iterator it = index->find(itemValue);
+        if (it != index->end()) {
+            // The "values" dict is public; the item is used only while it still holds it.
+            PyObject* item = it->second.item;
+            if (PyDict_GetItemString(values, it->second.name.c_str()) == item
+                && isEnumItem(enumType, item, itemValue)) {
+                Py_INCREF(item);
+                return item;
+            }
+            index->erase(it);
+        }
+    }
     PyObject *key, *value;
     Py_ssize_t pos = 0;
-    PyObject *values = PyDict_GetItemString(enumType->tp_dict, const_cast<char*>("values"));
-
     while (PyDict_Next(values, &pos, &key, &value)) {
-        SbkEnumObject *obj = reinterpret_cast<SbkEnumObject *>(value);
-        if (obj->ob_value == itemValue) {
-            Py_INCREF(obj);
+        if (isEnumItem(enumType, value, itemValue)) {
+            const char* name = index && Shiboken::String::check(key)
+                ? Shiboken::String::toCString(key) : nullptr;
+            if (name) {
+                const EnumValueEntry entry = {value, name};
+                index->insert(std::make_pair(itemValue, entry));
+            }
+            Py_INCREF(value);
             return value;
         }
     }
@@ -476,7 +527,20 @@ newItem(PyTypeObject *enumType, long itemValue, const char *itemName)
             PyDict_SetItemString(enumType->tp_dict, const_cast<char*>("values"), values);
             Py_DECREF(values); // ^ values still alive, because setitemstring incref it
         }
+        EnumValueIndex*& index = PepType_SETP(reinterpret_cast<SbkEnumType*>(enumType))->valueIndex;
+        if (!index)
+            index = new EnumValueIndex;
+        // An item replacing another one with the same name drops the old item.
+        PyObject* previous = PyDict_GetItemString(values, itemName);
+        if (previous && Py_TYPE(previous) == enumType) {
+            EnumValueIndex::iterator it = index->find(SBK_ENUM(previous)->ob_value);
+            if (it != index->end() && it->second.item == previous)
+                index->erase(it);
+        }
         PyDict_SetItemString(values, itemName, reinterpret_cast<PyObject*>(enumObj));
+        // Values shared by several items resolve to the first one.
+        const EnumValueEntry entry = {reinterpret_cast<PyObject*>(enumObj), itemName};
+        index->insert(std::make_pair(itemValue, entry));
     }
 
     return reinterpret_cast<PyObject*>(enumObj);
@@ -608,6 +672,7 @@ newTypeWithName(const char* name,
     SbkEnumType* enumType = reinterpret_cast<SbkEnumType*>(type);
     PepType_SETP(enumType)->cppName = cppName;
     PepType_SETP(enumType)->converterPtr = &PepType_SETP(enumType)->converter;
+    PepType_SETP(enumType)->valueIndex = nullptr;
     DeclaredEnumTypes::instance().addEnumType(type);
     return type;
 }
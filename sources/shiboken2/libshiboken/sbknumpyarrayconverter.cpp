@@ -131,13 +131,21 @@ namespace Conversions {
 // Internals from sbkarrayconverter.cpp
 SbkArrayConverter *createArrayConverter(IsArrayConvertibleToCppFunc toCppCheckFunc);
 void setArrayTypeConverter(int index, int dimension, SbkArrayConverter *c);
+void setWritableArrayTypeConverter(int index, int dimension, SbkArrayConverter *c);
 SbkArrayConverter *unimplementedArrayConverter();
 
+// How the data of a numpy array can be passed to a C++ array
+enum NumPyArrayAccess {
+    NotConvertible,
+    DirectAccess, // The C++ function works on the data of the numpy array
+    CopyAccess    // The data are gathered into a C-contiguous buffer of the expected type
+};
+
 template <int dimension>
-static bool isPrimitiveArray(PyObject *pyIn, int expectedNpType)
+static NumPyArrayAccess primitiveArrayAccess(PyObject *pyIn, int expectedNpType)
 {
     if (!PyArray_Check(pyIn))
-        return false;
+        return NotConvertible;
     PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
     if (debugNumPy) {
         std::cerr << __FUNCTION__ << "(expectedNpType=" << expectedNpType;
@@ -151,40 +159,73 @@ static bool isPrimitiveArray(PyObject *pyIn, int expectedNpType)
         warning(PyExc_RuntimeWarning, 0,
                 "%d dimensional numpy array passed to a function expecting a %d dimensional array.",
                 dim, dimension);
-        return false;
-    }
-    if ((PyArray_FLAGS(pya) & NPY_ARRAY_C_CONTIGUOUS) == 0) {
-        warning(PyExc_RuntimeWarning, 0,
-                "Cannot handle numpy arrays that do not have NPY_ARRAY_C_CONTIGUOUS set.");
-        return false;
+        return NotConvertible;
     }
     const int actualNpType = PyArray_TYPE(pya);
-    if (actualNpType != expectedNpType) {
+    if (PyArray_EquivTypenums(actualNpType, expectedNpType)
+        && PyArray_IS_C_CONTIGUOUS(pya) && PyArray_ISALIGNED(pya) && PyArray_ISNOTSWAPPED(pya)) {
+        return DirectAccess;
+    }
+    // Strided arrays and arrays of a related type (float32 for double, int16 for int...)
+    // are copied with the casting rules of numpy.
+    PyArray_Descr *expectedDescr = PyArray_DescrFromType(expectedNpType);
+    const bool canCast = PyArray_CanCastTypeTo(PyArray_DESCR(pya), expectedDescr, NPY_SAME_KIND_CASTING);
+    Py_DECREF(expectedDescr);
+    if (!canCast) {
         const char *actualName = npTypeName(actualNpType);
         const char *expectedName = npTypeName(expectedNpType);
         warning(PyExc_RuntimeWarning, 0,
                 "A numpy array of type %d (%s) was passed to a function expecting type %d (%s).",
                 actualNpType, actualName ? actualName : "",
                 expectedNpType, expectedName ? expectedName : "");
-        return false;
+        return NotConvertible;
     }
-    return true;
+    return CopyAccess;
 }
 
-static inline bool primitiveArrayCheck1(PyObject *pyIn, int expectedNpType, int expectedSize)
+// Arrays the C++ function may write to are only passed directly. A copy would
+// silently drop the writes, so such arrays are rejected as they were before
+// copies were introduced.
+static NumPyArrayAccess writableArrayAccess(NumPyArrayAccess access)
 {
-    if (!isPrimitiveArray<1>(pyIn, expectedNpType))
+    if (access != CopyAccess)
+        return access;
+    warning(PyExc_RuntimeWarning, 0,
+            "A numpy array that is not C-contiguous or not of the expected type was passed "
+            "to a function writing to it.");
+    return NotConvertible;
+}
+
+// Copy the elements of an array into a C-contiguous buffer of the expected type.
+// Returns false with a Python error set on failure, which fails the conversion
+// and keeps the C++ function from being called.
+static bool copyArrayData(PyArrayObject *pya, int npType, void *data)
+{
+    PyObject *target = PyArray_SimpleNewFromData(PyArray_NDIM(pya), PyArray_DIMS(pya), npType, data);
+    if (!target)
         return false;
-    if (expectedSize >= 0) {
+    if (debugNumPy)
+        std::cerr << __FUNCTION__ << ' ' << pya << " -> " << reinterpret_cast<PyArrayObject *>(target) << '\n';
+    const bool result = PyArray_CopyInto(reinterpret_cast<PyArrayObject *>(target), pya) == 0;
+    Py_DECREF(target);
+    if (!result && !PyErr_Occurred())
+        PyErr_SetString(PyExc_ValueError, "Unable to copy the numpy array.");
+    return result;
+}
+
+static inline NumPyArrayAccess primitiveArrayCheck1(PyObject *pyIn, int expectedNpType, int expectedSize)
+{
+    const NumPyArrayAccess access = primitiveArrayAccess<1>(pyIn, expectedNpType);
+    if (access != NotConvertible && expectedSize >= 0) {
         PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
         const int size = int(PyArray_DIMS(pya)[0]);
         if (size < expectedSize) {
             warning(PyExc_RuntimeWarning, 0, "A numpy array of size %d was passed to a function expects %d.",
                     size, expectedSize);
-            return false;
+            return NotConvertible;
         }
     }
-    return true;
+    return access;
 }
 
 // Convert one-dimensional array
@@ -199,52 +240,107 @@ static void convertArray1(PyObject *pyIn, void *cppOut)
     handle->setData(reinterpret_cast<T *>(PyArray_DATA(pya)), size_t(size));
 }
 
-// Convert 2 dimensional array
+// Copy one-dimensional array
+template <class T, int NumPyType>
+static void copyArray1(PyObject *pyIn, void *cppOut)
+{
+    ArrayHandle<T> *handle = reinterpret_cast<ArrayHandle<T> *>(cppOut);
+    PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
+    handle->allocate(PyArray_DIMS(pya)[0]);
+    if (!copyArrayData(pya, NumPyType, handle->data()))
+        handle->setData(nullptr, 0);
+}
+
+// Convert N dimensional array
 template <class T>
-static void convertArray2(PyObject *pyIn, void *cppOut)
+static void convertArrayN(PyObject *pyIn, void *cppOut)
 {
-    typedef typename Array2Handle<T, 1>::RowType RowType;
-    Array2Handle<T, 1> *handle = reinterpret_cast<Array2Handle<T, 1> *>(cppOut);
+    typedef typename ArrayNHandle<T, 1>::RowType RowType;
+    ArrayNHandle<T, 1> *handle = reinterpret_cast<ArrayNHandle<T, 1> *>(cppOut);
     PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
     handle->setData(reinterpret_cast<RowType *>(PyArray_DATA(pya)));
 }
 
+// Copy N dimensional array
 template <class T, int NumPyType>
+static void copyArrayN(PyObject *pyIn, void *cppOut)
+{
+    ArrayNHandle<T, 1> *handle = reinterpret_cast<ArrayNHandle<T, 1> *>(cppOut);
+    PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
+    handle->allocate(PyArray_SIZE(pya));
+    if (!copyArrayData(pya, NumPyType, static_cast<typename ArrayNHandle<T, 1>::RowType *>(*handle)))
+        handle->setData(nullptr);
+}
+
+template <class T, int NumPyType, bool writable>
 static PythonToCppFunc checkArray1(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return primitiveArrayCheck1(pyIn, NumPyType, dim1) ? convertArray1<T> : nullptr;
+    NumPyArrayAccess access = primitiveArrayCheck1(pyIn, NumPyType, dim1);
+    if (writable)
+        access = writableArrayAccess(access);
+    switch (access) {
+    case DirectAccess:
+        return convertArray1<T>;
+    case CopyAccess:
+        return copyArray1<T, NumPyType>;
+    case NotConvertible:
+        break;
+    }
+    return nullptr;
 }
 
-static inline bool primitiveArrayCheck2(PyObject *pyIn, int expectedNpType, int expectedDim1, int expectedDim2)
+// For N > 2, expectedDim2 is the number of elements of a row, that is,
+// the product of the sizes of all but the first dimension.
+template <int dimension>
+static inline NumPyArrayAccess primitiveArrayCheckN(PyObject *pyIn, int expectedNpType,
+                                                    int expectedDim1, int expectedDim2)
 {
-    if (!isPrimitiveArray<2>(pyIn, expectedNpType))
-        return false;
-    if (expectedDim2 >= 0) {
+    const NumPyArrayAccess access = primitiveArrayAccess<dimension>(pyIn, expectedNpType);
+    if (access != NotConvertible && expectedDim2 >= 0) {
         PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
-        const int dim1 = int(PyArray_DIMS(pya)[0]);
-        const int dim2 = int(PyArray_DIMS(pya)[1]);
+        const npy_intp *dims = PyArray_DIMS(pya);
+        const int dim1 = int(dims[0]);
+        npy_intp dim2 = 1;
+        for (int d = 1; d < dimension; ++d)
+            dim2 *= dims[d];
         if (dim1 != expectedDim1 || dim2 != expectedDim2) {
             warning(PyExc_RuntimeWarning, 0, "A numpy array of size %dx%d was passed to a function that expects %dx%d.",
-                    dim1, dim2, expectedDim1, expectedDim2);
-            return false;
+                    dim1, int(dim2), expectedDim1, expectedDim2);
+            return NotConvertible;
         }
     }
-    return true;
+    return access;
 }
 
-template <class T, int NumPyType>
-static PythonToCppFunc checkArray2(PyObject *pyIn, int dim1, int dim2)
+template <class T, int NumPyType, int dimension, bool writable>
+static PythonToCppFunc checkArrayN(PyObject *pyIn, int dim1, int dim2)
 {
-    return primitiveArrayCheck2(pyIn, NumPyType, dim1, dim2) ? convertArray2<T> : nullptr;
+    NumPyArrayAccess access = primitiveArrayCheckN<dimension>(pyIn, NumPyType, dim1, dim2);
+    if (writable)
+        access = writableArrayAccess(access);
+    switch (access) {
+    case DirectAccess:
+        return convertArrayN<T>;
+    case CopyAccess:
+        return copyArrayN<T, NumPyType>;
+    case NotConvertible:
+        break;
+    }
+    return nullptr;
 }
 
 template <class T>
-static void setOrExtendArrayConverter(int dimension, IsArrayConvertibleToCppFunc toCppCheckFunc)
+static void setOrExtendArrayConverter(int dimension, IsArrayConvertibleToCppFunc toCppCheckFunc,
+                                      bool writable)
 {
-    SbkArrayConverter *arrayConverter = ArrayTypeConverter<T>(dimension);
+    SbkArrayConverter *arrayConverter = writable
+        ? WritableArrayTypeConverter<T>(dimension) : ArrayTypeConverter<T>(dimension);
     if (arrayConverter == unimplementedArrayConverter()) {
         arrayConverter = createArrayConverter(toCppCheckFunc);
-        setArrayTypeConverter(ArrayTypeIndex<T>::index, dimension, arrayConverter);
+        if (writable)
+            setWritableArrayTypeConverter(ArrayTypeIndex<T>::index, dimension, arrayConverter);
+        else
+            setArrayTypeConverter(ArrayTypeIndex<T>::index, dimension, arrayConverter);
     } else {
         arrayConverter->toCppConversions.push_back(toCppCheckFunc);
     }
@@ -254,14 +350,47 @@ static void setOrExtendArrayConverter(int dimension, IsArrayConvertibleToCppFunc
 template <class T, int NumPyType>
 static inline void extendArrayConverter1()
 {
-    setOrExtendArrayConverter<T>(1, checkArray1<T, NumPyType>);
+    setOrExtendArrayConverter<T>(1, checkArray1<T, NumPyType, false>, false);
+    setOrExtendArrayConverter<T>(1, checkArray1<T, NumPyType, true>, true);
 }
 
-// Extend the converters for primitive type one-dimensional arrays by NumPy ones.
+// Extend the converters for primitive type multi-dimensional arrays by NumPy ones.
 template <class T, int NumPyType>
-static inline void extendArrayConverter2()
+static inline void extendArrayConverterN()
+{
+    static_assert(SBK_ARRAY_MAX_DIMENSION == 4, "Register the converters of all dimensions");
+    setOrExtendArrayConverter<T>(2, checkArrayN<T, NumPyType, 2, false>, false);
+    setOrExtendArrayConverter<T>(3, checkArrayN<T, NumPyType, 3, false>, false);
+    setOrExtendArrayConverter<T>(4, checkArrayN<T, NumPyType, 4, false>, false);
+    setOrExtendArrayConverter<T>(2, checkArrayN<T, NumPyType, 2, true>, true);
+    setOrExtendArrayConverter<T>(3, checkArrayN<T, NumPyType, 3, true>, true);
+    setOrExtendArrayConverter<T>(4, checkArrayN<T, NumPyType, 4, true>, true);
+}
+
+// Internal, for usage by sbkarrayconverter.cpp: Returns the number of rows of a
+// (rows, columns) numpy array convertible to double, -1 for other numpy arrays
+// and -2 if pyIn is not a numpy array.
+Py_ssize_t numPyDoubleMatrixRowCount(PyObject *pyIn, int columns)
+{
+    if (!PyArray_Check(pyIn))
+        return -2;
+    PyArrayObject *pya = reinterpret_cast<PyArrayObject *>(pyIn);
+    if (PyArray_NDIM(pya) != 2 || PyArray_DIMS(pya)[1] != columns)
+        return -1;
+    if (!PyArray_EquivTypenums(PyArray_TYPE(pya), NPY_DOUBLE)) {
+        PyArray_Descr *doubleDescr = PyArray_DescrFromType(NPY_DOUBLE);
+        const bool canCast = PyArray_CanCastTypeTo(PyArray_DESCR(pya), doubleDescr, NPY_SAME_KIND_CASTING);
+        Py_DECREF(doubleDescr);
+        if (!canCast)
+            return -1;
+    }
+    return PyArray_DIMS(pya)[0];
+}
+
+// Internal, for usage by sbkarrayconverter.cpp
+bool copyNumPyDoubleMatrix(PyObject *pyIn, double *data)
 {
-    setOrExtendArrayConverter<T>(2, checkArray2<T, NumPyType>);
+    return copyArrayData(reinterpret_cast<PyArrayObject *>(pyIn), NPY_DOUBLE, data);
 }
 
 void initNumPyArrayConverters()
@@ -277,31 +406,31 @@ void initNumPyArrayConverters()
     }
     // Extend the converters for primitive types by NumPy ones.
     extendArrayConverter1<short, NPY_SHORT>();
-    extendArrayConverter2<short, NPY_SHORT>();
+    extendArrayConverterN<short, NPY_SHORT>();
     extendArrayConverter1<unsigned short, NPY_SHORT>();
-    extendArrayConverter2<unsigned short, NPY_SHORT>();
+    extendArrayConverterN<unsigned short, NPY_SHORT>();
     extendArrayConverter1<int, NPY_INT>();
-    extendArrayConverter2<int, NPY_INT>();
+    extendArrayConverterN<int, NPY_INT>();
     extendArrayConverter1<unsigned int, NPY_UINT>();
-    extendArrayConverter2<unsigned int, NPY_UINT>();
+    extendArrayConverterN<unsigned int, NPY_UINT>();
     extendArrayConverter1<long long, NPY_LONGLONG>();
-    extendArrayConverter2<long long, NPY_LONGLONG>();
+    extendArrayConverterN<long long, NPY_LONGLONG>();
     extendArrayConverter1<unsigned long long, NPY_ULONGLONG>();
     if (sizeof(long) == 8) { // UNIX/LP64: ints typically come as long
         extendArrayConverter1<long long, NPY_LONG>();
-        extendArrayConverter2<long long, NPY_LONG>();
+        extendArrayConverterN<long long, NPY_LONG>();
         extendArrayConverter1<unsigned long long, NPY_ULONG>();
-        extendArrayConverter2<unsigned long long, NPY_ULONG>();
+        extendArrayConverterN<unsigned long long, NPY_ULONG>();
     } else if (sizeof(long) == sizeof(int)) {
         extendArrayConverter1<int, NPY_LONG>();
         extendArrayConverter1<unsigned, NPY_ULONG>();
-        extendArrayConverter2<int, NPY_LONG>();
-        extendArrayConverter2<unsigned, NPY_ULONG>();
+        extendArrayConverterN<int, NPY_LONG>();
+        extendArrayConverterN<unsigned, NPY_ULONG>();
     }
     extendArrayConverter1<float, NPY_FLOAT>();
-    extendArrayConverter2<float, NPY_FLOAT>();
+    extendArrayConverterN<float, NPY_FLOAT>();
     extendArrayConverter1<double, NPY_DOUBLE>();
-    extendArrayConverter2<double, NPY_DOUBLE>();
+    extendArrayConverterN<double, NPY_DOUBLE>();
 }
 
 } // namespace Conversions
@@ -87,4 +87,13 @@
     #define Py_hash_t long
 #endif
 
+// METH_FASTCALL is public API since Python 3.7 and part of the limited API since 3.10.
+// Modules generated with --enable-fastcall fall back to METH_VARARGS otherwise.
+#if PY_VERSION_HEX >= 0x03070000 && (!defined(Py_LIMITED_API) || Py_LIMITED_API >= 0x030A0000)
+    #define SBK_HAVE_FASTCALL
+    #define SBK_METH_FASTCALL METH_FASTCALL
+#else
+    #define SBK_METH_FASTCALL METH_VARARGS
+#endif
+
 #endif
@@ -203,6 +203,20 @@ Py_ssize_t len(PyObject* str)
     return 0;
 }
 
+PyObject* createStaticString(const char* str)
+{
+#ifdef IS_PY3K
+    PyObject* result = PyUnicode_InternFromString(str);
+#else
+    PyObject* result = PyString_InternFromString(str);
+#endif
+    if (result == NULL) {
+        // Happens only when memory is exhausted, no cleanup necessary.
+        Py_FatalError("unexpected error in createStaticString()");
+    }
+    return result;
+}
+
 } // namespace String
 
 } // namespace Shiboken
@@ -65,6 +65,12 @@ namespace String
     LIBSHIBOKEN_API PyObject* fromStringAndSize(const char* str, Py_ssize_t size);
     LIBSHIBOKEN_API int compare(PyObject* val1, const char* val2);
     LIBSHIBOKEN_API Py_ssize_t len(PyObject* str);
+    /**
+     * Returns an interned string that lives until the interpreter shuts down.
+     * Meant to be kept in a static variable by generated code, so that
+     * repeated lookups by name neither allocate nor compare characters.
+     */
+    LIBSHIBOKEN_API PyObject* createStaticString(const char* str);
 
 } // namespace String
 } // namespace Shiboken
@@ -120,6 +120,18 @@ Abstract* Derived::triggerAnotherImpossibleTypeDiscovery()
     return new AnotherSecretClass;
 }
 
+struct ShapeShiftingSecretClass : public Derived {
+    explicit ShapeShiftingSecretClass(Type type) : m_type(type) {}
+    Type type() const override { return m_type; }
+private:
+    Type m_type;
+};
+
+Abstract* Derived::triggerStatefulTypeDiscovery(Type type)
+{
+    return new ShapeShiftingSecretClass(type);
+}
+
 void Derived::pureVirtualPrivate()
 {
 }
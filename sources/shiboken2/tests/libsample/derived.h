@@ -82,6 +82,9 @@ public:
 
     static Abstract* triggerImpossibleTypeDiscovery();
     static Abstract* triggerAnotherImpossibleTypeDiscovery();
+    // Returns an object whose type() is \p type, letting type discovery tell differently
+    // of two objects of the same C++ class.
+    static Abstract* triggerStatefulTypeDiscovery(Type type);
 
     void hideFunction(HideType*) override {}
 protected:
@@ -199,17 +199,17 @@ acceptOddBoolReference(OddBool& x)
     return x;
 }
 
-int sumIntArray(int array[4])
+int sumIntArray(const int array[4])
 {
     return std::accumulate(array, array + 4, 0);
 }
 
-double sumDoubleArray(double array[4])
+double sumDoubleArray(const double array[4])
 {
     return std::accumulate(array, array + 4, double(0));
 }
 
-int sumIntMatrix(int m[2][3])
+int sumIntMatrix(const int m[2][3])
 {
     int result = 0;
     for (int r = 0; r < 2; ++r) {
@@ -219,7 +219,7 @@ int sumIntMatrix(int m[2][3])
     return result;
 }
 
-double sumDoubleMatrix(double m[2][3])
+double sumDoubleMatrix(const double m[2][3])
 {
     double result = 0;
     for (int r = 0; r < 2; ++r) {
@@ -229,6 +229,24 @@ double sumDoubleMatrix(double m[2][3])
     return result;
 }
 
+int sumIntCube(const int cube[2][3][4])
+{
+    int result = 0;
+    for (int p = 0; p < 2; ++p) {
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 4; ++c)
+                result += cube[p][r][c];
+        }
+    }
+    return result;
+}
+
+void scaleIntArray(int array[4], int factor)
+{
+    for (int i = 0; i < 4; ++i)
+        array[i] *= factor;
+}
+
 ArrayModifyTest::ArrayModifyTest()
 {
 }
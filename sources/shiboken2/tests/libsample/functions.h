@@ -81,10 +81,12 @@ LIBSAMPLE_API double acceptDouble(double x);
 LIBSAMPLE_API int acceptIntReference(int& x);
 LIBSAMPLE_API OddBool acceptOddBoolReference(OddBool& x);
 
-LIBSAMPLE_API int sumIntArray(int array[4]);
-LIBSAMPLE_API double sumDoubleArray(double array[4]);
-LIBSAMPLE_API int sumIntMatrix(int m[2][3]);
-LIBSAMPLE_API double sumDoubleMatrix(double m[2][3]);
+LIBSAMPLE_API int sumIntArray(const int array[4]);
+LIBSAMPLE_API double sumDoubleArray(const double array[4]);
+LIBSAMPLE_API int sumIntMatrix(const int m[2][3]);
+LIBSAMPLE_API double sumDoubleMatrix(const double m[2][3]);
+LIBSAMPLE_API int sumIntCube(const int cube[2][3][4]);
+LIBSAMPLE_API void scaleIntArray(int array[4], int factor);
 
 class LIBSAMPLE_API ArrayModifyTest
 {
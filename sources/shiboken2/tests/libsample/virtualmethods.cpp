@@ -29,6 +29,7 @@
 #include "virtualmethods.h"
 
 int VirtualDtor::dtor_called = 0;
+int DeferredDtor::dtor_called = 0;
 
 double
 VirtualMethods::virtualMethod0(Point pt, int val, Complex cpx, bool b)
@@ -153,5 +153,18 @@ private:
     static int dtor_called;
 };
 
+class LIBSAMPLE_API DeferredDtor
+{
+public:
+    DeferredDtor() {}
+    ~DeferredDtor() { dtor_called++; }
+
+    static int dtorCalled() { return dtor_called; }
+    static void resetDtorCounter() { dtor_called = 0; }
+
+private:
+    static int dtor_called;
+};
+
 #endif // VIRTUALMETHODS_H
 
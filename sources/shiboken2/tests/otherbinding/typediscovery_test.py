@@ -60,5 +60,26 @@ class TypeDiscoveryTest(unittest.TestCase):
         obj = OtherMultipleDerived.createObject("OtherMultipleDerived");
         self.assertEqual(type(obj), OtherMultipleDerived)
 
+    def testRepeatedTypeDiscovery(self):
+        # The second round is answered by the resolved type cache.
+        for i in range(2):
+            a = Derived.triggerImpossibleTypeDiscovery()
+            self.assertEqual(type(a), Abstract)
+            a.pureVirtual()
+            a = Derived.triggerAnotherImpossibleTypeDiscovery()
+            self.assertEqual(type(a), Derived)
+            obj = OtherMultipleDerived.createObject("MDerived3");
+            self.assertEqual(type(obj), MDerived3)
+
+    def testStatefulTypeDiscovery(self):
+        # Both objects have the same C++ class, but the polymorphic id expression of
+        # Derived looks at their state.
+        for i in range(2):
+            a = Derived.triggerStatefulTypeDiscovery(Abstract.TpDerived)
+            self.assertEqual(type(a), Derived)
+            a = Derived.triggerStatefulTypeDiscovery(Abstract.TpAbstract)
+            self.assertEqual(type(a), Abstract)
+            a.pureVirtual()
+
 if __name__ == '__main__':
     unittest.main()
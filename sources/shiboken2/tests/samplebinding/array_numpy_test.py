@@ -60,5 +60,35 @@ class ArrayTester(unittest.TestCase):
         doubleMatrix = numpy.array([[1, 2, 3], [4, 5, 6]], dtype = 'double')
         self.assertEqual(sample.sumDoubleMatrix(doubleMatrix), 21)
 
+    def testIntCube(self):
+        intCube = numpy.arange(24, dtype = 'int32').reshape(2, 3, 4)
+        self.assertEqual(sample.sumIntCube(intCube), 276)
+
+    def testStridedArray(self):
+        doubleMatrix = numpy.array([[1, 2, 3, 4], [5, 6, 7, 8]], dtype = 'double')
+        self.assertEqual(sample.sumDoubleArray(doubleMatrix.T[:, 0]), 10)
+        self.assertEqual(sample.sumDoubleArray(numpy.arange(8, dtype = 'double')[::2]), 12)
+
+    def testStridedMatrix(self):
+        intMatrix = numpy.array([[1, 4], [2, 5], [3, 6]], dtype = 'int32')
+        self.assertEqual(sample.sumIntMatrix(intMatrix.T), 21)
+
+    def testConvertedArray(self):
+        self.assertEqual(sample.sumDoubleArray(numpy.array([1, 2, 3, 4], dtype = 'float32')), 10)
+        self.assertEqual(sample.sumIntArray(numpy.array([1, 2, 3, 4], dtype = 'int16')), 10)
+        self.assertEqual(sample.sumIntArray(numpy.array([1, 2, 3, 4], dtype = 'int64')), 10)
+        doubleMatrix = numpy.array([[1, 2, 3], [4, 5, 6]], dtype = 'float32')
+        self.assertEqual(sample.sumDoubleMatrix(doubleMatrix), 21)
+
+    def testWritableArray(self):
+        intList = numpy.array([1, 2, 3, 4], dtype = 'int32')
+        sample.scaleIntArray(intList, 2)
+        self.assertEqual(list(intList), [2, 4, 6, 8])
+
+    def testCopiedWritableArrayIsRejected(self):
+        # The function would write to a copy
+        self.assertRaises(TypeError, sample.scaleIntArray, numpy.arange(8, dtype = 'int32')[::2], 2)
+        self.assertRaises(TypeError, sample.scaleIntArray, numpy.array([1, 2, 3, 4], dtype = 'int16'), 2)
+
 if __name__ == '__main__' and hasNumPy:
     unittest.main()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2018 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the deferred destruction of C++ objects.'''
+
+import unittest
+
+import shiboken2 as shiboken
+from sample import DeferredDtor
+
+class DeferredDtorTest(unittest.TestCase):
+    '''Test case for types whose C++ destructors run in batches.'''
+
+    def setUp(self):
+        shiboken.runDeferredDestructors()
+        DeferredDtor.resetDtorCounter()
+
+    def testDestructorsRun(self):
+        '''Every deferred destructor eventually runs, exactly once.'''
+        objs = [DeferredDtor() for i in range(10)]
+        del objs
+        shiboken.runDeferredDestructors()
+        self.assertEqual(DeferredDtor.dtorCalled(), 10)
+        shiboken.runDeferredDestructors()
+        self.assertEqual(DeferredDtor.dtorCalled(), 10)
+
+    def testLargeBatch(self):
+        '''Batches are run when they grow large.'''
+        for i in range(1000):
+            DeferredDtor()
+        shiboken.runDeferredDestructors()
+        self.assertEqual(DeferredDtor.dtorCalled(), 1000)
+
+    def testExplicitDelete(self):
+        '''shiboken.delete() destroys the C++ object right away.'''
+        obj = DeferredDtor()
+        shiboken.delete(obj)
+        self.assertEqual(DeferredDtor.dtorCalled(), 1)
+        self.assertFalse(shiboken.isValid(obj))
+
+if __name__ == '__main__':
+    unittest.main()
@@ -160,6 +160,29 @@ class DuckPunchingTest(unittest.TestCase):
 
         monkey.exists = None
 
+    def testMonkeyPatchOnClassAfterVirtualCall(self):
+        '''Replaces 'virtualMethod0' on a subclass after C++ already called the original one.'''
+        duck = Duck()
+        pt, val, cpx, b = Point(1.1, 2.2), 4, complex(3.3, 4.4), True
+
+        result1 = duck.callVirtualMethod0(pt, val, cpx, b)
+        self.assertFalse(self.duck_method_called)
+
+        def myVirtualMethod0(obj, pt, val, cpx, b):
+            self.duck_method_called = True
+            return VirtualMethods.virtualMethod0(obj, pt, val, cpx, b) * self.multiplier
+        Duck.virtualMethod0 = myVirtualMethod0
+        try:
+            result2 = duck.callVirtualMethod0(pt, val, cpx, b)
+            self.assertTrue(self.duck_method_called)
+            self.assertEqual(result2, result1 * self.multiplier)
+        finally:
+            del Duck.virtualMethod0
+
+        self.duck_method_called = False
+        self.assertEqual(duck.callVirtualMethod0(pt, val, cpx, b), result1)
+        self.assertFalse(self.duck_method_called)
+
     def testForInfiniteRecursion(self):
         def myVirtualMethod0(obj, pt, val, cpx, b):
             self.call_counter += 1
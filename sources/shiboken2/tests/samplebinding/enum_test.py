@@ -56,6 +56,24 @@ class EnumTest(unittest.TestCase):
         enum = SampleNamespace.Option(999)
         self.assertEqual(eval(repr(enum)), enum)
 
+    def testEnumItemFromValue(self):
+        '''Building an enum from an integer returns the item with that value.'''
+        for value_name, item in SampleNamespace.Option.values.items():
+            enum = SampleNamespace.Option(int(item))
+            self.assertEqual(enum, item)
+            self.assertEqual(enum.name, item.name)
+
+    def testEnumItemFromValueAfterRemoval(self):
+        '''Removing an item from the values dict does not invalidate the item built from its value.'''
+        values = SampleNamespace.OutValue.values
+        item = values.pop('ZeroOut')
+        try:
+            enum = SampleNamespace.OutValue(0)
+            self.assertEqual(enum, item)
+            self.assertEqual(enum.name, b('ZeroOut'))
+        finally:
+            values['ZeroOut'] = item
+
     def testHashability(self):
         self.assertEqual(hash(SampleNamespace.TwoIn), hash(SampleNamespace.TwoOut))
         self.assertNotEqual(hash(SampleNamespace.TwoIn), hash(SampleNamespace.OneIn))
@@ -66,6 +66,18 @@ class TestKeepReference(unittest.TestCase):
         del view
         self.assertEqual(getrefcount(model), refcount1)
 
+    def testReferenceCountingWhenSettingAgain(self):
+        '''Setting the same model-like object again keeps a single reference, setting None releases it.'''
+        model = ObjectModel()
+        refcount1 = getrefcount(model)
+        view = ObjectView()
+        for i in range(3):
+            view.setModel(model)
+        self.assertEqual(getrefcount(model), refcount1 + 1)
+
+        view.setModel(None)
+        self.assertEqual(getrefcount(model), refcount1)
+
     def testReferreedObjectSurvivalAfterContextEnd(self):
         '''Model-like object assigned to a view-like object must survive after get out of context.'''
         def createModelAndSetToView(view):
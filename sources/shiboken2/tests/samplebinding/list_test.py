@@ -80,6 +80,24 @@ class ListConversionTest(unittest.TestCase):
         result = lu.sumList(lst)
         self.assertEqual(result, sum(lst))
 
+    def testSumLongListIntegers(self):
+        '''Test method that sums a long list of integer values.'''
+        lu = ListUser()
+        lst = list(range(100000))
+        self.assertEqual(lu.sumList(lst), sum(lst))
+
+    def testConversionOfMixedIntegerList(self):
+        '''Test converting a list whose items are not all exact integers.'''
+        lu = ListUser()
+        lu.setList([1, True, 3, 4])
+        self.assertEqual(lu.getList(), [1, 1, 3, 4])
+
+    def testConversionOfNonListSequence(self):
+        '''Test converting a sequence that is neither a list nor a tuple.'''
+        lu = ListUser()
+        lu.setList(range(5))
+        self.assertEqual(lu.getList(), [0, 1, 2, 3, 4])
+
     def testConversionInBothDirections(self):
         '''Test converting a list from Python to C++ and back again.'''
         lu = ListUser()
@@ -31,6 +31,7 @@
 
 '''Test cases for PointF class'''
 
+import copy
 import unittest
 
 from sample import PointF
@@ -65,5 +66,28 @@ class PointFTest(unittest.TestCase):
         expected = PointF((pt1.x() + pt2.x()) / 2.0, (pt1.y() + pt2.y()) / 2.0)
         self.assertEqual(pt1.midpoint(pt2), expected)
 
+    def testFreeList(self):
+        '''PointF keeps a free list of 8 wrappers, this goes beyond its capacity.'''
+        step = PointF(1.0, 2.0)
+        points = [step * i for i in range(20)]
+        for i, pt in enumerate(points):
+            self.assertEqual(pt, PointF(i, 2.0 * i))
+        del points
+        # Recycled wrappers and C++ instances do not keep stale state
+        total = PointF()
+        for i in range(20):
+            total = total + copy.copy(step)
+        self.assertEqual(total, PointF(20.0, 40.0))
+
+    def testFreeListWithSubclass(self):
+        '''Instances of Python subclasses do not go to the free list of PointF.'''
+        class MyPointF(PointF):
+            pass
+        for i in range(10):
+            pt = MyPointF(i, i)
+            self.assertEqual(type(pt), MyPointF)
+            self.assertEqual(type(pt + pt), PointF)
+            self.assertEqual(pt.x(), i)
+
 if __name__ == '__main__':
     unittest.main()
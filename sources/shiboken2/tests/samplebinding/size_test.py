@@ -31,9 +31,11 @@
 
 '''Test cases for operator overloads on Size class'''
 
+import copy
 import unittest
 
-from sample import Size
+import shiboken2 as shiboken
+from sample import Point, Size, SizeF
 
 class PointTest(unittest.TestCase):
     '''Test case for Size class, including operator overloads.'''
@@ -114,6 +116,42 @@ class PointTest(unittest.TestCase):
         self.assertTrue(s1 > s2)
         self.assertFalse(s2 > s1)
 
+    def testInlineStorage(self):
+        '''Copies of Size converted to Python live inside their wrappers.'''
+        sizes = [Size(i, 1.0) + Size(1.0, i) for i in range(100)]
+        for i, s in enumerate(sizes):
+            self.assertEqual(s, Size(i + 1.0, i + 1.0))
+        s = copy.copy(sizes[10])
+        del sizes
+        self.assertEqual(s, Size(11.0, 11.0))
+        s.setWidth(3.0)
+        self.assertEqual(s.width(), 3.0)
+
+    def testInlineStorageDelete(self):
+        '''Deleting a Size stored inside its wrapper invalidates the wrapper.'''
+        s = Size(1.0, 2.0) * 2.0
+        shiboken.delete(s)
+        self.assertFalse(shiboken.isValid(s))
+        del s
+
+    def testInlineStorageWithSubclass(self):
+        '''Python subclasses of Size keep working with the inline storage of Size.'''
+        class MySize(Size):
+            pass
+        s = MySize(2.0, 3.0)
+        self.assertEqual(s + s, Size(4.0, 6.0))
+        self.assertEqual(type(s + s), Size)
+        del s
+
+    def testInlineStorageWithMultipleInheritance(self):
+        '''Two classes with inline storage cannot be base classes of the same Python class.'''
+        with self.assertRaises(TypeError):
+            class MySize(Size, SizeF):
+                pass
+        class MyPointSize(Size, Point):
+            pass
+        self.assertTrue(issubclass(MyPointSize, Size))
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2016 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the memory layout of wrapper instances.'''
+
+import gc
+import sys
+import unittest
+import weakref
+
+from sample import ObjectType, Point, Str
+
+class SlottedPoint(Point):
+    __slots__ = ('tag',)
+
+class ObjectTypeAndStr(ObjectType, Str):
+    def __init__(self, name):
+        ObjectType.__init__(self)
+        Str.__init__(self, name)
+
+class WrapperStorageTest(unittest.TestCase):
+    '''Wrappers keep their private data in the same allocation as the Python object.'''
+
+    def testManyValueTypeWrappers(self):
+        points = [Point(i, -i) for i in range(10000)]
+        for i, pt in enumerate(points):
+            self.assertEqual(pt.x(), i)
+            self.assertEqual(pt.y(), -i)
+        del points
+        gc.collect()
+
+    def testSlotsAfterInlineStorage(self):
+        pt = SlottedPoint(1, 2)
+        pt.tag = 'tag'
+        self.assertEqual(pt.tag, 'tag')
+        self.assertEqual(pt.x(), 1)
+        self.assertEqual(pt.y(), 2)
+
+    def testInstanceDictAndWeakref(self):
+        pt = Point(3, 4)
+        pt.extra = 'extra'
+        ref = weakref.ref(pt)
+        self.assertEqual(ref().extra, 'extra')
+        del pt
+        gc.collect()
+        self.assertEqual(ref(), None)
+
+    def testMultipleCppBases(self):
+        objs = [ObjectTypeAndStr(str(i)) for i in range(1000)]
+        for i, obj in enumerate(objs):
+            obj.setObjectName(obj)
+            self.assertEqual(obj.objectName(), str(i))
+        del objs
+        gc.collect()
+
+    def testParentChildDestruction(self):
+        parent = ObjectType()
+        children = [ObjectType(parent) for i in range(1000)]
+        self.assertEqual(len(parent.children()), 1000)
+        del children
+        del parent
+        gc.collect()
+
+if __name__ == '__main__':
+    unittest.main()